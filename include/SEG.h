@@ -0,0 +1,79 @@
+/*! @file
+ *
+ *  @brief Large 7-segment numeral readout for the display
+ *
+ *  Digits are built from filled rectangles, so any size can be drawn and
+ *  each segment is a single fillRect() on the display. The readout keeps
+ *  the segments it last drew per digit and only redraws the ones that
+ *  changed, which makes an update with nothing new free.
+ *
+ *  @author agent
+ *  @date 2026-10-19
+ */
+
+#ifndef _SEG_H_
+#define _SEG_H_
+
+#include <Adafruit_GFX.h>
+
+// Most digits (including a leading minus) a readout can show
+#define SEG_MAX_DIGITS 4
+
+// Segment mask meaning "unknown", forces a digit to be redrawn in full
+#define SEG_INVALID 0xFF
+
+// A numeric readout on the display
+//
+// Segments are a thickness t, horizontal ones inset by t at each end so no
+// two segments overlap and each can be cleared without touching another.
+typedef struct
+{
+  int16_t x, y;                   // Top-left of the first digit
+  uint8_t w, h;                   // Size of a digit, in pixels
+  uint8_t t;                      // Segment thickness, in pixels
+  uint8_t gap;                    // Space between digits, in pixels
+  uint8_t digits;                 // Number of digits shown
+  uint8_t shown[SEG_MAX_DIGITS];  // Segments currently lit per digit
+} SEG_Readout_t;
+
+/*! @brief Sets up a readout
+ *
+ *  @param readout  readout to set up
+ *  @param x        x coordinate of the top-left of the first digit
+ *  @param y        y coordinate of the top-left of the first digit
+ *  @param w        width of a digit
+ *  @param h        height of a digit
+ *  @param t        segment thickness
+ *  @param gap      space between digits
+ *  @param digits   number of digits, at most SEG_MAX_DIGITS
+ *
+ *  @return  void
+ */
+void SEG_init(SEG_Readout_t *readout, int16_t x, int16_t y, uint8_t w,
+              uint8_t h, uint8_t t, uint8_t gap, uint8_t digits);
+
+/*! @brief Marks every digit of the readout for a full redraw
+ *
+ *  @param readout  readout whose area has been drawn over or cleared
+ *
+ *  @return  void
+ */
+void SEG_invalidate(SEG_Readout_t *readout);
+
+/*! @brief Shows a value on the readout, redrawing only changed segments
+ *
+ *  The value is right-aligned with a leading minus when negative. Values
+ *  that do not fit are shown as a row of minus signs.
+ *
+ *  @param display  display to draw on
+ *  @param readout  readout to update
+ *  @param value    value to show
+ *  @param color    color of lit segments
+ *  @param bg       color of unlit segments
+ *
+ *  @return  true if anything was drawn
+ */
+bool SEG_draw(Adafruit_GFX *display, SEG_Readout_t *readout, int value,
+              uint16_t color, uint16_t bg);
+
+#endif //_SEG_H_
@@ -14,11 +14,17 @@
 #include <Adafruit_SSD1306.h>
 
 // Software version, used to display at startup
-const String SW_VER = "1.0.0";
+const char SW_VER[] PROGMEM = "1.0.0";
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
+// Period (ms) each boot screen (splash, then SW_VER) is shown for
+#define UI_BOOT_SCREEN_PERIOD 2000
+
+// Period (ms) at which the display is redrawn even if nothing has changed
+#define UI_REFRESH_PERIOD 1000
+
 // Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
 #define OLED_RESET 4 // Reset pin # (or -1 if sharing Arduino reset pin)
 
@@ -44,13 +50,15 @@ typedef union {
 
 /*! @brief Initilises User Interface
  *
- *  Sets up btn pins and initilises the display 
+ *  Sets up btn pins and initilises the display. Returns without waiting
+ *  on the boot screens, UI_updateDisplay() shows them
  * 
  *  @param display pointer to the display handle
  *
- *  @return  void
+ *  @return  false if the display could not be started, in which case
+ *           UI_updateDisplay() does nothing and the btns still work
  */
-void UI_init(Adafruit_SSD1306 *display);
+bool UI_init(Adafruit_SSD1306 *display);
 
 /*! @brief Updates display with current status
  * 
@@ -61,6 +69,10 @@ void UI_init(Adafruit_SSD1306 *display);
  * 
  *  @note This should be called in a constant loop
  *        i.e. execute every 10ms, the faster the better
+ *        The display is only redrawn when what it shows has changed, or
+ *        every UI_REFRESH_PERIOD ms regardless
+ *        The splash and SW_VER screens are shown first, for
+ *        UI_BOOT_SCREEN_PERIOD ms each or until a btn is pressed
  */
 void UI_updateDisplay(Adafruit_SSD1306 *display, int targetSpeed);
 
@@ -38,6 +38,11 @@ POSSIBILITY OF SUCH DAMAGE.
 #elif defined(ESP8266) || defined(ESP32)
 #include <pgmspace.h>
 #endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // Many (but maybe not all) non-AVR board installs define macros
 // for compatibility with existing PROGMEM-reading AVR code.
@@ -62,7 +67,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
 #endif
 
-inline GFXglyph *pgm_read_glyph_ptr(const GFXfont *gfxFont, uint8_t c) {
+inline GFXglyph *pgm_read_glyph_ptr(const GFXfont *gfxFont, uint16_t c) {
 #ifdef __AVR__
   return &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
 #else
@@ -86,10 +91,88 @@ inline uint8_t *pgm_read_bitmap_ptr(const GFXfont *gfxFont) {
 #endif //__AVR__
 }
 
+// Glyph for character c, or NULL if the font has none. Sparse fonts list
+// their runs of characters in ascending order, searched by halves.
+inline GFXglyph *pgm_read_char_glyph_ptr(const GFXfont *gfxFont, uint16_t c) {
+#ifdef GFX_ENABLE_UTF8_FONTS
+  if (!(pgm_read_byte(&gfxFont->flags) & GFX_FONT_UTF8))
+#endif
+    c &= 0xFF; // 8-bit font: a sign-extended char still finds its glyph
+  uint8_t n = pgm_read_byte(&gfxFont->ranges);
+  if (!n) {
+    uint8_t first = pgm_read_byte(&gfxFont->first);
+    if ((c < first) || (c > (uint8_t)pgm_read_byte(&gfxFont->last)))
+      return NULL;
+    return pgm_read_glyph_ptr(gfxFont, c - first);
+  }
+#ifdef __AVR__
+  GFXrange *range = (GFXrange *)pgm_read_pointer(&gfxFont->range);
+#else
+  GFXrange *range = gfxFont->range; // As pgm_read_glyph_ptr()
+#endif
+  uint8_t lo = 0; // Find the last run starting at or before c
+  while (n > lo) {
+    uint8_t mid = (lo + n) / 2;
+    if (c < pgm_read_word(&range[mid].first))
+      n = mid;
+    else
+      lo = mid + 1;
+  }
+  if (!lo)
+    return NULL;
+  range += lo - 1;
+  if (c > pgm_read_word(&range->last))
+    return NULL;
+  return pgm_read_glyph_ptr(gfxFont, pgm_read_word(&range->glyph) + c -
+                                         pgm_read_word(&range->first));
+}
+
+#ifdef GFX_ENABLE_UTF8_FONTS
+// Feed one byte of UTF-8 text, returns the code point it completes or 0.
+// more holds the continuation bytes still due; stray continuation bytes
+// and characters past U+FFFF are dropped.
+static uint16_t utf8Next(uint8_t c, uint16_t *code, uint8_t *more) {
+  if ((c & 0xC0) == 0x80) {
+    if (!*more)
+      return 0;
+    *code = (*code << 6) | (c & 0x3F);
+    return --*more ? 0 : *code;
+  }
+  *more = 0;
+  if (c < 0x80)
+    return c;
+  if ((c & 0xE0) == 0xC0) {
+    *code = c & 0x1F;
+    *more = 1;
+  } else if ((c & 0xF0) == 0xE0) {
+    *code = c & 0x0F;
+    *more = 2;
+  }
+  return 0;
+}
+
+// Code point of the UTF-8 character at s in PROGMEM, 0 if it is not one
+// utf8Next() keeps, and its length in bytes
+static uint16_t utf8At(const uint8_t *s, uint8_t *len) {
+  uint16_t code = 0, cp;
+  uint8_t more = 0, n = 0;
+  do {
+    if ((cp = utf8Next(pgm_read_byte(&s[n++]), &code, &more)))
+      break;
+  } while (more && ((pgm_read_byte(&s[n]) & 0xC0) == 0x80));
+  *len = n;
+  return cp;
+}
+#endif // GFX_ENABLE_UTF8_FONTS
+
 #ifndef min
 #define min(a, b) (((a) < (b)) ? (a) : (b))
 #endif
 
+#ifndef max
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
 #ifndef _swap_int16_t
 #define _swap_int16_t(a, b)                                                    \
   {                                                                            \
@@ -117,6 +200,9 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
   wrap = true;
   _cp437 = false;
   gfxFont = NULL;
+#ifdef GFX_ENABLE_UTF8_FONTS
+  utf8More = 0;
+#endif
 }
 
 /**************************************************************************/
@@ -158,6 +244,36 @@ void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     ystep = -1;
   }
 
+  // Clip once here rather than pixel by pixel: trim the run along the
+  // major axis, then to the steps whose minor coordinate is on-screen,
+  // and resume from there with the error term Bresenham would have had.
+  // After k steps the minor axis has moved m(k) = ceil((k*dy - e0) / dx)
+  // times (e0 = dx / 2), so the pixels are exactly those of the whole line.
+  int16_t maxMajor = (steep ? _height : _width) - 1,
+          maxMinor = (steep ? _width : _height) - 1;
+  if ((x0 < 0) || (x1 > maxMajor) || (min(y0, y1) < 0) ||
+      (max(y0, y1) > maxMinor)) {
+    int32_t kFirst = (x0 < 0) ? -x0 : 0, kLast = min(x1, maxMajor) - x0;
+    int32_t mLo = (ystep > 0) ? -y0 : y0 - maxMinor, // Range of m(k) that
+        mHi = (ystep > 0) ? maxMinor - y0 : y0;      // stays on-screen
+    if (mHi < 0)
+      return;
+    if (dy) {
+      if (mLo > 0)
+        kFirst = max(kFirst, ((mLo - 1) * dx + err) / dy + 1);
+      kLast = min(kLast, (mHi * dx + err) / dy);
+    } else if (mLo > 0) {
+      return;
+    }
+    if (kFirst > kLast)
+      return;
+    int32_t m = dy ? (kFirst * dy - err + dx - 1) / dx : 0;
+    y0 += ystep * m;
+    err += m * dx - kFirst * dy;
+    x1 = x0 + kLast;
+    x0 += kFirst;
+  }
+
   for (; x0 <= x1; x0++) {
     if (steep) {
       writePixel(y0, x0, color);
@@ -359,6 +475,9 @@ void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
 #if defined(ESP8266)
   yield();
 #endif
+  if ((x0 + r < 0) || (x0 - r >= _width) || (y0 + r < 0) ||
+      (y0 - r >= _height))
+    return; // Wholly off-screen
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
@@ -406,6 +525,10 @@ void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
 /**************************************************************************/
 void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
                                     uint8_t cornername, uint16_t color) {
+  if ((x0 + r < 0) || (x0 - r >= _width) || (y0 + r < 0) ||
+      (y0 - r >= _height))
+    return; // Wholly off-screen
+
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
@@ -451,6 +574,10 @@ void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
 /**************************************************************************/
 void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
                               uint16_t color) {
+  if ((x0 + r < 0) || (x0 - r >= _width) || (y0 + r < 0) ||
+      (y0 - r >= _height))
+    return; // Wholly off-screen
+
   startWrite();
   writeFastVLine(x0, y0 - r, 2 * r + 1, color);
   fillCircleHelper(x0, y0, r, 3, 0, color);
@@ -472,6 +599,17 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
                                     uint8_t corners, int16_t delta,
                                     uint16_t color) {
 
+  // Columns run from y0 - r to y0 + r + delta at most. Drop halves that
+  // are wholly off-screen, and below skip any off-screen columns.
+  if ((y0 - r >= _height) || (y0 + r + delta < 0))
+    return;
+  if ((x0 + r < 0) || (x0 >= _width))
+    corners &= ~1;
+  if ((x0 < 0) || (x0 - r >= _width))
+    corners &= ~2;
+  if (!corners)
+    return;
+
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
@@ -494,15 +632,15 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
     // These checks avoid double-drawing certain lines, important
     // for the SSD1306 library which has an INVERT drawing mode.
     if (x < (y + 1)) {
-      if (corners & 1)
+      if ((corners & 1) && (x0 + x < _width))
         writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
-      if (corners & 2)
+      if ((corners & 2) && (x0 - x >= 0))
         writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
     }
     if (y != py) {
-      if (corners & 1)
+      if ((corners & 1) && (x0 + py < _width))
         writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
-      if (corners & 2)
+      if ((corners & 2) && (x0 - py >= 0))
         writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
       py = y;
     }
@@ -635,6 +773,11 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     _swap_int16_t(x0, x1);
   }
 
+  // Nothing to do if wholly above, below, left or right of the screen
+  if ((y2 < 0) || (y0 >= _height) || (max(x0, max(x1, x2)) < 0) ||
+      (min(x0, min(x1, x2)) >= _width))
+    return;
+
   startWrite();
   if (y0 == y2) { // Handle awkward all-on-same-line case as its own thing
     a = b = x0;
@@ -653,7 +796,7 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 
   int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
           dx12 = x2 - x1, dy12 = y2 - y1;
-  int32_t sa = 0, sb = 0;
+  int32_t sa, sb;
 
   // For upper part of triangle, find scanline crossings for segments
   // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
@@ -661,12 +804,20 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   // error there), otherwise scanline y1 is skipped here and handled
   // in the second loop...which also avoids a /0 error here if y0=y1
   // (flat-topped triangle).
+  // Both loops are limited to on-screen scanlines, starting part way down
+  // with the crossing sums they'd have reached, and spans lying wholly
+  // left or right of the screen are skipped.
   if (y1 == y2)
     last = y1; // Include y1 scanline
   else
     last = y1 - 1; // Skip it
+  if (last >= _height)
+    last = _height - 1;
 
-  for (y = y0; y <= last; y++) {
+  y = (y0 < 0) ? 0 : y0;
+  sa = (int32_t)dx01 * (y - y0);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= last; y++) {
     a = x0 + sa / dy01;
     b = x0 + sb / dy02;
     sa += dx01;
@@ -677,11 +828,14 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     */
     if (a > b)
       _swap_int16_t(a, b);
-    writeFastHLine(a, y, b - a + 1, color);
+    if ((b >= 0) && (a < _width))
+      writeFastHLine(a, y, b - a + 1, color);
   }
 
   // For lower part of triangle, find scanline crossings for segments
   // 0-2 and 1-2.  This loop is skipped if y1=y2.
+  if (y2 >= _height)
+    y2 = _height - 1;
   sa = (int32_t)dx12 * (y - y1);
   sb = (int32_t)dx02 * (y - y0);
   for (; y <= y2; y++) {
@@ -695,7 +849,109 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     */
     if (a > b)
       _swap_int16_t(a, b);
-    writeFastHLine(a, y, b - a + 1, color);
+    if ((b >= 0) && (a < _width))
+      writeFastHLine(a, y, b - a + 1, color);
+  }
+  endWrite();
+}
+
+// Floor division, as C rounds toward zero and edge sums may be negative
+static int32_t floorDiv(int32_t a, int32_t b) {
+  int32_t q = a / b;
+  return ((a % b) && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+/**************************************************************************/
+/*!
+   @brief     Fill a polygon, convex or not, using the even-odd rule. Edges
+              run through pixel corners and a pixel is filled if its centre
+              is inside, so polygons sharing an edge never overlap or leave
+              a gap between them, and no pixel is drawn twice.
+    @param    pts    Vertex coordinates, as n x,y pairs (in RAM)
+    @param    n      Number of vertices, at least 3. Past
+                     GFX_POLYGON_MAX_VERTICES only the outline is drawn.
+    @param    color  16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Adafruit_GFX::fillPolygon(const int16_t *pts, uint8_t n, uint16_t color) {
+  // Per edge: rows yStart <= y < yEnd cross it. The left-most pixel whose
+  // centre is right of the crossing is ceil(N / den2), where N steps by a
+  // constant each row, kept as quotient q and remainder r < den2.
+  struct {
+    int16_t yStart, yEnd, q, qStep;
+    int32_t r, rStep, den2;
+  } edges[GFX_POLYGON_MAX_VERTICES];
+  int16_t xs[GFX_POLYGON_MAX_VERTICES]; // Crossings on current row
+  uint8_t nEdges = 0, i, j;
+  int16_t yMin = 0x7FFF, yMax = -0x8000, y;
+
+  if (n < 3)
+    return;
+  if (n > GFX_POLYGON_MAX_VERTICES) { // Too many for the edge table
+    startWrite();
+    for (i = 0, j = n - 1; i < n; j = i++)
+      writeLine(pts[j * 2], pts[j * 2 + 1], pts[i * 2], pts[i * 2 + 1], color);
+    endWrite();
+    return;
+  }
+
+  for (i = 0; i < n; i++) {
+    if (pts[i * 2 + 1] < yMin)
+      yMin = pts[i * 2 + 1];
+    if (pts[i * 2 + 1] > yMax)
+      yMax = pts[i * 2 + 1];
+  }
+  y = (yMin < 0) ? 0 : yMin; // First row drawn
+  if (yMax > _height)
+    yMax = _height; // Rows drawn are y to yMax - 1
+
+  for (i = 0; i < n; i++) {
+    j = (i + 1 < n) ? i + 1 : 0;
+    int16_t xa = pts[i * 2], ya = pts[i * 2 + 1], xb = pts[j * 2],
+            yb = pts[j * 2 + 1];
+    if (ya == yb)
+      continue; // Horizontal edges are never crossed
+    if (ya > yb) {
+      _swap_int16_t(xa, xb);
+      _swap_int16_t(ya, yb);
+    }
+    if ((yb <= y) || (ya >= yMax))
+      continue; // Wholly above or below the rows drawn
+    int32_t den2 = 2 * (int32_t)(yb - ya), step = 2 * (int32_t)(xb - xa);
+    int16_t y0 = (ya < y) ? y : ya; // Row the edge state starts at
+    int32_t N = (2 * (int32_t)xa - 1) * (yb - ya) +
+                (int32_t)(xb - xa) * (2 * (y0 - ya) + 1);
+    edges[nEdges].yStart = y0;
+    edges[nEdges].yEnd = yb;
+    edges[nEdges].den2 = den2;
+    edges[nEdges].q = floorDiv(N, den2);
+    edges[nEdges].r = N - (int32_t)edges[nEdges].q * den2;
+    edges[nEdges].qStep = floorDiv(step, den2);
+    edges[nEdges].rStep = step - (int32_t)edges[nEdges].qStep * den2;
+    nEdges++;
+  }
+
+  startWrite();
+  for (; y < yMax; y++) {
+    uint8_t nx = 0;
+    for (i = 0; i < nEdges; i++) {
+      if ((y < edges[i].yStart) || (y >= edges[i].yEnd))
+        continue;
+      // Insertion-sort this crossing in, then step the edge down a row
+      int16_t x = edges[i].q + (edges[i].r != 0);
+      for (j = nx++; j && (xs[j - 1] > x); j--)
+        xs[j] = xs[j - 1];
+      xs[j] = x;
+      edges[i].q += edges[i].qStep;
+      if ((edges[i].r += edges[i].rStep) >= edges[i].den2) {
+        edges[i].r -= edges[i].den2;
+        edges[i].q++;
+      }
+    }
+    for (i = 0; i + 1 < nx; i += 2) {
+      if ((xs[i] < xs[i + 1]) && (xs[i + 1] > 0) && (xs[i] < _width))
+        writeFastHLine(xs[i], y, xs[i + 1] - xs[i], color);
+    }
   }
   endWrite();
 }
@@ -870,6 +1126,57 @@ void Adafruit_GFX::drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+   @brief   Draw a PROGMEM-resident 1-bit image run-length coded by
+   imageconvert -r: the drawBitmap() byte layout, PackBits coded. Each
+   header byte n is followed by n + 1 bytes to copy (n < 128) or by one
+   byte to repeat 257 - n times (n >= 128). Unset bits are transparent;
+   runs of set bits in a row are drawn as lines.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  coded byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color 16-bit 5-6-5 Color to draw pixels with
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawRLEBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                 int16_t w, int16_t h, uint16_t color) {
+
+  uint8_t byte = 0, value = 0, left = 0; // left: bytes to go in this code
+  bool repeat = false;
+
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++) {
+    int16_t run = 0; // Set pixels ending before pixel i
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7) {
+        byte <<= 1;
+      } else {
+        if (!left) {
+          uint8_t n = pgm_read_byte(bitmap++);
+          repeat = (n >= 128);
+          left = repeat ? 257 - n : n + 1;
+          if (repeat)
+            value = pgm_read_byte(bitmap++);
+        }
+        byte = repeat ? value : pgm_read_byte(bitmap++);
+        left--;
+      }
+      if (byte & 0x80) {
+        run++;
+      } else if (run) {
+        writeFastHLine(x + i - run, y, run, color);
+        run = 0;
+      }
+    }
+    if (run)
+      writeFastHLine(x + w - run, y, run, color);
+  }
+  endWrite();
+}
+
 /**************************************************************************/
 /*!
    @brief   Draw a PROGMEM-resident 8-bit image (grayscale) at the specified
@@ -1099,20 +1406,158 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
 
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
+#ifdef GFX_ENABLE_PACKED_FONTS
+// Reader for the bitstream of a GFX_FONT_PACKED glyph, MSB first
+typedef struct {
+  const uint8_t *p; ///< Next byte to load from PROGMEM
+  uint8_t bits;     ///< Current byte
+  uint8_t mask;     ///< Next bit of the current byte, 0 when used up
+} GFXbitReader;
+
+static uint8_t readBit(GFXbitReader *r) {
+  if (!r->mask) {
+    r->bits = pgm_read_byte(r->p++);
+    r->mask = 0x80;
+  }
+  uint8_t b = r->bits & r->mask;
+  r->mask >>= 1;
+  return b ? 1 : 0;
+}
+
+static uint8_t readBits(GFXbitReader *r, uint8_t n) {
+  uint8_t v = 0;
+  while (n--)
+    v = (v << 1) | readBit(r);
+  return v;
+}
+
+// Order-2 exp-Golomb number
+static uint8_t readGap(GFXbitReader *r) {
+  uint8_t z = 0;
+  while (!readBit(r))
+    z++;
+  return (readBits(r, z + 2) | (1 << (z + 2))) - 4;
+}
+
+/**************************************************************************/
+/*!
+   @brief   Fill the set runs of a packed glyph row, repeated over rows
+    @param    gfx     Display to draw on, inside startWrite()/endWrite()
+    @param    t       Columns at which the row changes color, in pairs
+    @param    n       Number of changes
+    @param    x       Left of the glyph, scaled
+    @param    y       Top of the first row, scaled
+    @param    rows    Number of identical rows
+    @param    size_x  Font magnification level in X-axis
+    @param    size_y  Font magnification level in Y-axis
+    @param    color   16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+static void fillPackedRows(Adafruit_GFX *gfx, const uint8_t *t, uint8_t n,
+                           int16_t x, int16_t y, uint8_t rows, uint8_t size_x,
+                           uint8_t size_y, uint16_t color) {
+  for (uint8_t i = 0; i < n; i += 2)
+    gfx->writeFillRect(x + t[i] * size_x, y, (t[i + 1] - t[i]) * size_x,
+                       rows * size_y, color);
+}
+#endif // GFX_ENABLE_PACKED_FONTS
+
+#ifdef GFX_ENABLE_AA_FONTS
+/**************************************************************************/
+/*!
+   @brief   Fill a palette with the 16 steps from one 5-6-5 color to another
+    @param    palette  16 entries, palette[0] = bg and palette[15] = color
+    @param    color    16-bit 5-6-5 Color at full coverage
+    @param    bg       16-bit 5-6-5 Color at no coverage
+*/
+/**************************************************************************/
+static void blendPalette565(uint16_t *palette, uint16_t color, uint16_t bg) {
+  uint8_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+  uint8_t br = bg >> 11, bgg = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+  for (uint8_t a = 0; a < 16; a++) {
+    uint8_t na = 15 - a;
+    palette[a] = (((r * a + br * na + 7) / 15) << 11) |
+                 (((g * a + bgg * na + 7) / 15) << 5) |
+                 ((b * a + bb * na + 7) / 15);
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Draw a GFX_FONT_AA2 or GFX_FONT_AA4 glyph of the current font
+            as one rectangle per run of equal coverage in a row
+    @param    x        Bottom left corner x coordinate
+    @param    y        Bottom left corner y coordinate
+    @param    glyph    PROGMEM pointer to the glyph
+    @param    palette  16 colors by 4-bit coverage, from blending the text
+                       color toward the background
+    @param    opaque   If false, coverage is rounded to palette[15] or
+                       nothing instead of blended
+    @param    size_x   Font magnification level in X-axis
+    @param    size_y   Font magnification level in Y-axis
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawGlyphAA(int16_t x, int16_t y, const GFXglyph *glyph,
+                               const uint16_t *palette, bool opaque,
+                               uint8_t size_x, uint8_t size_y) {
+  const uint8_t *bitmap = fontBitmap(glyph);
+  uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+  int8_t xo = pgm_read_byte(&glyph->xOffset),
+         yo = pgm_read_byte(&glyph->yOffset);
+  uint8_t bpp = (pgm_read_byte(&gfxFont->flags) & GFX_FONT_AA4) ? 4 : 2;
+  uint8_t step = (bpp == 4) ? 1 : 5; // Coverage to palette index
+  uint8_t bits = 0, left = 0;
+
+  startWrite();
+  for (uint8_t yy = 0; yy < h; yy++) {
+    int16_t gy = y + (yo + yy) * size_y;
+    uint8_t cov = 0, run = 0;
+    for (uint8_t xx = 0; xx <= w; xx++) {
+      uint8_t a = 0; // One past the row ends the last run
+      if (xx < w) {
+        if (!left) {
+          bits = pgm_read_byte(bitmap++);
+          left = 8;
+        }
+        a = (bits >> (8 - bpp)) * step;
+        if (!opaque)
+          a = -(a >> 3) & 15; // Half covered or more is solid
+        bits <<= bpp;
+        left -= bpp;
+      }
+      if (a == cov) {
+        run++;
+        continue;
+      }
+      if (cov && (run == 1) && (size_x == 1) && (size_y == 1)) {
+        writePixel(x + xo + xx - 1, gy, palette[cov]); // Common at edges
+      } else if (cov) {
+        writeFillRect(x + (xo + xx - run) * size_x, gy, run * size_x, size_y,
+                      palette[cov]);
+      }
+      cov = a;
+      run = 1;
+    }
+  }
+  endWrite();
+}
+#endif // GFX_ENABLE_AA_FONTS
+
 // Draw a character
 /**************************************************************************/
 /*!
    @brief   Draw a single character
     @param    x   Bottom left corner x coordinate
     @param    y   Bottom left corner y coordinate
-    @param    c   The 8-bit font-indexed character (likely ascii)
+    @param    c   The 8-bit font-indexed character (likely ascii), or a
+                  code point with a GFX_FONT_UTF8 font
     @param    color 16-bit 5-6-5 Color to draw chraracter with
     @param    bg 16-bit 5-6-5 Color to fill background with (if same as color,
    no background)
     @param    size  Font magnification level, 1 is 'original' size
 */
 /**************************************************************************/
-void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, uint16_t c,
                             uint16_t color, uint16_t bg, uint8_t size) {
   drawChar(x, y, c, color, bg, size, size);
 }
@@ -1123,7 +1568,8 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
    @brief   Draw a single character
     @param    x   Bottom left corner x coordinate
     @param    y   Bottom left corner y coordinate
-    @param    c   The 8-bit font-indexed character (likely ascii)
+    @param    c   The 8-bit font-indexed character (likely ascii), or a
+                  code point with a GFX_FONT_UTF8 font
     @param    color 16-bit 5-6-5 Color to draw chraracter with
     @param    bg 16-bit 5-6-5 Color to fill background with (if same as color,
    no background)
@@ -1131,7 +1577,7 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
 */
 /**************************************************************************/
-void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, uint16_t c,
                             uint16_t color, uint16_t bg, uint8_t size_x,
                             uint8_t size_y) {
 
@@ -1143,43 +1589,65 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
         ((y + 8 * size_y - 1) < 0))   // Clip top
       return;
 
-    if (!_cp437 && (c >= 176))
-      c++; // Handle 'classic' charset behavior
+    const uint8_t *glyph = classicGlyph(c);
 
     startWrite();
-    for (int8_t i = 0; i < 5; i++) { // Char bitmap = 5 columns
-      uint8_t line = pgm_read_byte(&font[c * 5 + i]);
-      for (int8_t j = 0; j < 8; j++, line >>= 1) {
-        if (line & 1) {
-          if (size_x == 1 && size_y == 1)
+    if (size_x == 1 && size_y == 1) {
+      for (int8_t i = 0; i < 5; i++) { // Char bitmap = 5 columns
+        uint8_t line = pgm_read_byte(&glyph[i]);
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+          if (line & 1)
             writePixel(x + i, y + j, color);
-          else
-            writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y,
-                          color);
-        } else if (bg != color) {
-          if (size_x == 1 && size_y == 1)
+          else if (bg != color)
             writePixel(x + i, y + j, bg);
-          else
-            writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
         }
       }
-    }
-    if (bg != color) { // If opaque, draw vertical line for last column
-      if (size_x == 1 && size_y == 1)
+      if (bg != color) // If opaque, draw vertical line for last column
         writeFastVLine(x + 5, y, 8, bg);
-      else
-        writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+    } else {
+      // Scaled: one rectangle per vertical run of like bits in a column
+      // rather than one per bit, and identical neighbouring columns (the
+      // stems of E, H, M...) share their rectangles. Opaque glyphs include
+      // the blank 6th column.
+      int8_t cols = (bg != color) ? 6 : 5;
+      uint8_t next = pgm_read_byte(&glyph[0]);
+      for (int8_t i = 0; i < cols;) {
+        uint8_t line = next;
+        int8_t k = 0;
+        do {
+          k++;
+          next = (i + k < 5) ? pgm_read_byte(&glyph[i + k]) : 0;
+        } while ((i + k < cols) && (next == line));
+        int16_t xx = x + i * size_x, ww = k * size_x;
+        i += k;
+        for (int8_t j = 0; j < 8;) {
+          if ((bg == color) && !line)
+            break; // Nothing left to draw in this column
+          uint8_t set = line & 1;
+          int8_t n = 0;
+          do {
+            n++;
+            line >>= 1;
+          } while ((j + n < 8) && ((line & 1) == set));
+          if (set)
+            writeFillRect(xx, y + j * size_y, ww, n * size_y, color);
+          else if (bg != color)
+            writeFillRect(xx, y + j * size_y, ww, n * size_y, bg);
+          j += n;
+        }
+      }
     }
     endWrite();
 
   } else { // Custom font
 
     // Character is assumed previously filtered by write() to eliminate
-    // newlines, returns, non-printable characters, etc.  Calling
-    // drawChar() directly with 'bad' characters of font may cause mayhem!
+    // newlines, returns, non-printable characters, etc.  Characters the
+    // font lacks are skipped.
 
-    c -= (uint8_t)pgm_read_byte(&gfxFont->first);
-    GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c);
+    GFXglyph *glyph = pgm_read_char_glyph_ptr(gfxFont, c);
+    if (!glyph)
+      return;
     uint8_t *bitmap = pgm_read_bitmap_ptr(gfxFont);
 
     uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
@@ -1212,8 +1680,95 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
+    if (pgm_read_byte(&gfxFont->flags) & (GFX_FONT_AA2 | GFX_FONT_AA4)) {
+#ifdef GFX_ENABLE_AA_FONTS
+      // Anti-aliased glyphs are the exception: their partly covered
+      // pixels are blended toward bg, so they need one to look right.
+      uint16_t palette[16];
+      blendPalette565(palette, color, bg);
+      drawGlyphAA(x, y, glyph, palette, bg != color, size_x, size_y);
+#endif
+      return;
+    }
+
+    if (pgm_read_byte(&gfxFont->flags) & GFX_FONT_PACKED) {
+#ifdef GFX_ENABLE_PACKED_FONTS
+      // Decode straight into spans. Runs of identical rows become one
+      // rectangle; a row is checked for changes before it replaces the
+      // held one, so only the current row's color changes are kept.
+      GFXbitReader r = {&bitmap[bo], 0, 0};
+      uint8_t t[GFX_FONT_PACKED_MAX_CHANGES], n = 0, rows = 0;
+      int16_t gx = x + xo * size_x, gy = y + yo * size_y;
+
+      startWrite();
+      for (yy = 0; yy < h; yy++) {
+        if (!readBit(&r)) { // Changes move relative to the row above
+          GFXbitReader peek = r;
+          for (xx = 0; (xx < n) && !readBit(&peek); xx++)
+            ;
+          if (xx == n) { // Identical, extend the held rows
+            r = peek;
+            rows++;
+            continue;
+          }
+          fillPackedRows(this, t, n, gx, gy, rows, size_x, size_y, color);
+          for (xx = 0; xx < n; xx++) {
+            if (readBit(&r)) {
+              uint8_t d = readBit(&r) + 1;
+              if (readBit(&r))
+                t[xx] -= d;
+              else
+                t[xx] += d;
+            }
+          }
+        } else { // New set of changes
+          fillPackedRows(this, t, n, gx, gy, rows, size_x, size_y, color);
+          uint8_t col = 0;
+          n = readBits(&r, 4) * 2;
+          for (xx = 0; xx < n; xx++)
+            t[xx] = col += readGap(&r);
+        }
+        gy += rows * size_y;
+        rows = 1;
+      }
+      fillPackedRows(this, t, n, gx, gy, rows, size_x, size_y, color);
+      endWrite();
+#endif
+      return;
+    }
+
+    if (pgm_read_byte(&gfxFont->flags) & GFX_FONT_PAGES) {
+#ifdef GFX_ENABLE_PAGE_FONTS
+      // One rectangle per vertical run of set bits in a column byte stack
+      uint8_t pad = yo & 7;
+      bitmap += bo;
+      startWrite();
+      for (xx = 0; xx < w; xx++) {
+        int16_t gx = x + (xo + xx) * size_x;
+        uint8_t run = 0;
+        for (yy = 0; yy < h; yy++) {
+          uint8_t r = yy + pad;
+          if (pgm_read_byte(&bitmap[(r / 8) * w + xx]) & (1 << (r & 7))) {
+            run++;
+          } else if (run) {
+            writeFillRect(gx, y + (yo + yy - run) * size_y, size_x,
+                          run * size_y, color);
+            run = 0;
+          }
+        }
+        if (run) {
+          writeFillRect(gx, y + (yo + h - run) * size_y, size_x, run * size_y,
+                        color);
+        }
+      }
+      endWrite();
+#endif
+      return;
+    }
+
     startWrite();
     for (yy = 0; yy < h; yy++) {
+      uint8_t run = 0; // Scaled glyphs: length of current span of set bits
       for (xx = 0; xx < w; xx++) {
         if (!(bit++ & 7)) {
           bits = pgm_read_byte(&bitmap[bo++]);
@@ -1222,21 +1777,125 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
           if (size_x == 1 && size_y == 1) {
             writePixel(x + xo + xx, y + yo + yy, color);
           } else {
-            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
-                          size_x, size_y, color);
+            run++;
           }
+        } else if (run) {
+          writeFillRect(x + (xo16 + xx - run) * size_x,
+                        y + (yo16 + yy) * size_y, run * size_x, size_y, color);
+          run = 0;
         }
         bits <<= 1;
       }
+      if (run) {
+        writeFillRect(x + (xo16 + w - run) * size_x, y + (yo16 + yy) * size_y,
+                      run * size_x, size_y, color);
+      }
     }
     endWrite();
 
   } // End classic vs custom font
 }
+
+/**************************************************************************/
+/*!
+    @brief  Locate a character of the current custom font
+    @param  c  The 8-bit font-indexed character (likely ascii), or a code
+               point with a GFX_FONT_UTF8 font
+    @returns   PROGMEM pointer to the character's glyph, NULL if the font
+               has none
+*/
+/**************************************************************************/
+const GFXglyph *Adafruit_GFX::fontGlyph(uint16_t c) const {
+  return pgm_read_char_glyph_ptr(gfxFont, c);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Locate the bitmap of a custom font glyph
+    @param  glyph  PROGMEM pointer to a glyph of the current font
+    @returns       PROGMEM pointer to the glyph's bitmap, in the font's
+                   GFX_FONT_* format
+*/
+/**************************************************************************/
+const uint8_t *Adafruit_GFX::fontBitmap(const GFXglyph *glyph) const {
+  return pgm_read_bitmap_ptr(gfxFont) + pgm_read_word(&glyph->bitmapOffset);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Locate a character of the 'classic' built-in font
+    @param  c  The 8-bit font-indexed character (likely ascii)
+    @returns   PROGMEM pointer to the character's 5 column bytes, LSB at top
+*/
+/**************************************************************************/
+const uint8_t *Adafruit_GFX::classicGlyph(unsigned char c) const {
+  if (!_cp437 && (c >= 176))
+    c++; // Handle 'classic' charset behavior
+  return &font[c * 5];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Map a rectangle from rotated to raw (unrotated) coordinates and
+            clip it to the raw WIDTH and HEIGHT, for subclasses that fill
+            their own buffers
+    @param  x  Top left corner x coordinate, updated in place
+    @param  y  Top left corner y coordinate, updated in place
+    @param  w  Width in pixels, updated in place
+    @param  h  Height in pixels, updated in place
+    @returns   true if any part of the rectangle remains, false if none
+    @note   As Adafruit_GFX::fillRect() draws them, a rectangle with a
+            zero or negative width is empty, and one with a zero or
+            negative height covers rows y + h - 1 through y
+*/
+/**************************************************************************/
+bool Adafruit_GFX::rawRect(int16_t *x, int16_t *y, int16_t *w,
+                           int16_t *h) const {
+  if (*w <= 0)
+    return false;
+  if (*h <= 0) { // Each column is writeLine(x, y, x, y + h - 1)
+    *y += *h - 1;
+    *h = 2 - *h;
+  }
+
+  int16_t t;
+  switch (rotation) {
+  case 1: // Swap x/y and w/h, then invert x
+    t = *x, *x = *y, *y = t;
+    t = *w, *w = *h, *h = t;
+    *x = WIDTH - *x - *w;
+    break;
+  case 2: // Invert x and y
+    *x = WIDTH - *x - *w;
+    *y = HEIGHT - *y - *h;
+    break;
+  case 3: // Swap x/y and w/h, then invert y
+    t = *x, *x = *y, *y = t;
+    t = *w, *w = *h, *h = t;
+    *y = HEIGHT - *y - *h;
+    break;
+  }
+
+  if (*x < 0) { // Clip left
+    *w += *x;
+    *x = 0;
+  }
+  if (*y < 0) { // Clip top
+    *h += *y;
+    *y = 0;
+  }
+  if ((*x + *w) > WIDTH) // Clip right
+    *w = WIDTH - *x;
+  if ((*y + *h) > HEIGHT) // Clip bottom
+    *h = HEIGHT - *y;
+  return (*w > 0) && (*h > 0);
+}
+
 /**************************************************************************/
 /*!
     @brief  Print one byte/character of data, used to support print()
-    @param  c  The 8-bit ascii character to write
+    @param  c  The 8-bit ascii character to write, or the next byte of
+               UTF-8 text with a GFX_FONT_UTF8 font
 */
 /**************************************************************************/
 size_t Adafruit_GFX::write(uint8_t c) {
@@ -1262,9 +1921,15 @@ size_t Adafruit_GFX::write(uint8_t c) {
       cursor_y +=
           (int16_t)textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
     } else if (c != '\r') {
-      uint8_t first = pgm_read_byte(&gfxFont->first);
-      if ((c >= first) && (c <= (uint8_t)pgm_read_byte(&gfxFont->last))) {
-        GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+      uint16_t code = c;
+#ifdef GFX_ENABLE_UTF8_FONTS
+      if (pgm_read_byte(&gfxFont->flags) & GFX_FONT_UTF8) {
+        if (!(code = utf8Next(c, &utf8Code, &utf8More)))
+          return 1; // Part of a multi-byte character
+      }
+#endif
+      GFXglyph *glyph = pgm_read_char_glyph_ptr(gfxFont, code);
+      if (glyph) {
         uint8_t w = pgm_read_byte(&glyph->width),
                 h = pgm_read_byte(&glyph->height);
         if ((w > 0) && (h > 0)) { // Is there an associated bitmap?
@@ -1274,8 +1939,8 @@ size_t Adafruit_GFX::write(uint8_t c) {
             cursor_y += (int16_t)textsize_y *
                         (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
           }
-          drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
-                   textsize_y);
+          drawChar(cursor_x, cursor_y, code, textcolor, textbgcolor,
+                   textsize_x, textsize_y);
         }
         cursor_x +=
             (uint8_t)pgm_read_byte(&glyph->xAdvance) * (int16_t)textsize_x;
@@ -1355,7 +2020,8 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
     @brief    Helper to determine size of a character with current font/size.
        Broke this out as it's used by both the PROGMEM- and RAM-resident
    getTextBounds() functions.
-    @param    c     The ascii character in question
+    @param    c     The ascii character in question, or a code point with a
+                    GFX_FONT_UTF8 font
     @param    x     Pointer to x location of character
     @param    y     Pointer to y location of character
     @param    minx  Minimum clipping value for X
@@ -1364,8 +2030,9 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
     @param    maxy  Maximum clipping value for Y
 */
 /**************************************************************************/
-void Adafruit_GFX::charBounds(char c, int16_t *x, int16_t *y, int16_t *minx,
-                              int16_t *miny, int16_t *maxx, int16_t *maxy) {
+void Adafruit_GFX::charBounds(uint16_t c, int16_t *x, int16_t *y,
+                              int16_t *minx, int16_t *miny, int16_t *maxx,
+                              int16_t *maxy) {
 
   if (gfxFont) {
 
@@ -1373,10 +2040,8 @@ void Adafruit_GFX::charBounds(char c, int16_t *x, int16_t *y, int16_t *minx,
       *x = 0;        // Reset x to zero, advance y by one line
       *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
     } else if (c != '\r') { // Not a carriage return; is normal char
-      uint8_t first = pgm_read_byte(&gfxFont->first),
-              last = pgm_read_byte(&gfxFont->last);
-      if ((c >= first) && (c <= last)) { // Char present in this font?
-        GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+      GFXglyph *glyph = pgm_read_char_glyph_ptr(gfxFont, c);
+      if (glyph) { // Char present in this font?
         uint8_t gw = pgm_read_byte(&glyph->width),
                 gh = pgm_read_byte(&glyph->height),
                 xa = pgm_read_byte(&glyph->xAdvance);
@@ -1444,6 +2109,12 @@ void Adafruit_GFX::getTextBounds(const char *str, int16_t x, int16_t y,
                                  int16_t *x1, int16_t *y1, uint16_t *w,
                                  uint16_t *h) {
   uint8_t c; // Current character
+  uint16_t cp;
+#ifdef GFX_ENABLE_UTF8_FONTS
+  uint8_t more = 0;
+  uint16_t code = 0;
+  bool utf8 = gfxFont && (pgm_read_byte(&gfxFont->flags) & GFX_FONT_UTF8);
+#endif
 
   *x1 = x;
   *y1 = y;
@@ -1451,8 +2122,15 @@ void Adafruit_GFX::getTextBounds(const char *str, int16_t x, int16_t y,
 
   int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
 
-  while ((c = *str++))
-    charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+  while ((c = *str++)) {
+#ifdef GFX_ENABLE_UTF8_FONTS
+    if (!(cp = utf8 ? utf8Next(c, &code, &more) : c))
+      continue; // Part of a multi-byte character
+#else
+    cp = c;
+#endif
+    charBounds(cp, &x, &y, &minx, &miny, &maxx, &maxy);
+  }
 
   if (maxx >= minx) {
     *x1 = minx;
@@ -1502,6 +2180,12 @@ void Adafruit_GFX::getTextBounds(const __FlashStringHelper *str, int16_t x,
                                  int16_t y, int16_t *x1, int16_t *y1,
                                  uint16_t *w, uint16_t *h) {
   uint8_t *s = (uint8_t *)str, c;
+  uint16_t cp;
+#ifdef GFX_ENABLE_UTF8_FONTS
+  uint8_t more = 0;
+  uint16_t code = 0;
+  bool utf8 = gfxFont && (pgm_read_byte(&gfxFont->flags) & GFX_FONT_UTF8);
+#endif
 
   *x1 = x;
   *y1 = y;
@@ -1509,8 +2193,15 @@ void Adafruit_GFX::getTextBounds(const __FlashStringHelper *str, int16_t x,
 
   int16_t minx = _width, miny = _height, maxx = -1, maxy = -1;
 
-  while ((c = pgm_read_byte(s++)))
-    charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+  while ((c = pgm_read_byte(s++))) {
+#ifdef GFX_ENABLE_UTF8_FONTS
+    if (!(cp = utf8 ? utf8Next(c, &code, &more) : c))
+      continue; // Part of a multi-byte character
+#else
+    cp = c;
+#endif
+    charBounds(cp, &x, &y, &minx, &miny, &maxx, &maxy);
+  }
 
   if (maxx >= minx) {
     *x1 = minx;
@@ -1522,6 +2213,176 @@ void Adafruit_GFX::getTextBounds(const __FlashStringHelper *str, int16_t x,
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief    Break a flash string into lines no wider than boxW with the
+   current font and size, and measure each line. Layouts are kept in a small
+   LRU cache keyed on the string pointer, font, size and box width, so a
+   static label is only measured the first time it is drawn. Lines break at
+   spaces where possible, else mid-word, and always at '\n'; any text past
+   GFX_LAYOUT_MAX_LINES lines is dropped.
+    @param    str     The flash string to lay out
+    @param    boxW    Width available to each line
+    @returns  The layout, valid until the next call to layoutText()
+*/
+/**************************************************************************/
+const GFXtextLayout *Adafruit_GFX::layoutText(const __FlashStringHelper *str,
+                                              int16_t boxW) {
+  static GFXtextLayout cache[GFX_LAYOUT_CACHE_SIZE];
+  static uint8_t used;
+  GFXtextLayout l;
+  uint8_t i;
+
+  for (i = 0; i < used; i++) {
+    if ((cache[i].str == str) && (cache[i].font == gfxFont) &&
+        (cache[i].sizeX == textsize_x) && (cache[i].sizeY == textsize_y) &&
+        (cache[i].boxW == boxW))
+      break;
+  }
+
+  if (i < used) { // Hit: move it to the front
+    l = cache[i];
+  } else { // Miss: lay it out, dropping the least recently used
+    const uint8_t *s = (const uint8_t *)str;
+    int16_t adv = textsize_y * (gfxFont ? (uint8_t)pgm_read_byte(
+                                              &gfxFont->yAdvance)
+                                        : 8),
+            top = 0x7FFF, bottom = -0x7FFF, y = 0;
+    uint16_t pos = 0;
+    uint8_t c, n = 1;
+    uint16_t cp;
+    boolean oldWrap = wrap;
+#ifdef GFX_ENABLE_UTF8_FONTS
+    boolean utf8 = gfxFont && (pgm_read_byte(&gfxFont->flags) & GFX_FONT_UTF8);
+#endif
+
+    wrap = false; // Lines are broken here, not by charBounds()
+    l.str = str;
+    l.font = gfxFont;
+    l.sizeX = textsize_x;
+    l.sizeY = textsize_y;
+    l.boxW = boxW;
+    l.width = 0;
+    l.lines = 0;
+
+    do {
+      uint16_t start = pos, end, brk = 0;
+      int16_t x = 0, minx = 0x7FFF, miny = 0x7FFF, maxx = -0x7FFF,
+              maxy = -0x7FFF;
+
+      // Advance until the text ends or the next character would not fit
+      for (;;) {
+        c = pgm_read_byte(&s[pos]);
+        if (!c || (c == '\n')) {
+          end = pos;
+          break;
+        }
+        int16_t cx = x, cy = 0, x1 = 0x7FFF, y1 = 0x7FFF, x2 = -1, y2 = -1;
+#ifdef GFX_ENABLE_UTF8_FONTS
+        cp = utf8 ? utf8At(&s[pos], &n) : c;
+#else
+        cp = c;
+#endif
+        charBounds(cp, &cx, &cy, &x1, &y1, &x2, &y2);
+        if ((x2 >= boxW) && (pos > start)) {
+          end = ((c != ' ') && brk) ? brk : pos;
+          break;
+        }
+        if ((c == ' ') && (pos > start))
+          brk = pos; // Candidate break: end the line before this space
+        x = cx;
+        pos += n;
+      }
+      if (c && (c != '\n')) {
+        pos = end; // Soft break, the next line starts after any spaces
+        while (pgm_read_byte(&s[pos]) == ' ')
+          pos++;
+        c = pgm_read_byte(&s[pos]);
+      } else if (c) {
+        pos++; // Skip the newline
+      }
+      while ((end > start) && (pgm_read_byte(&s[end - 1]) == ' '))
+        end--;
+
+      // Measure the ink of the line as drawn
+      x = 0;
+      for (uint16_t j = start; j < end; j += n) {
+        int16_t cy = y;
+#ifdef GFX_ENABLE_UTF8_FONTS
+        cp = utf8 ? utf8At(&s[j], &n) : pgm_read_byte(&s[j]);
+#else
+        cp = pgm_read_byte(&s[j]);
+#endif
+        charBounds(cp, &x, &cy, &minx, &miny, &maxx, &maxy);
+      }
+      GFXtextLine *ln = &l.line[l.lines++];
+      ln->start = start;
+      ln->len = end - start;
+      ln->x1 = (maxx >= minx) ? minx : 0;
+      ln->w = (maxx >= minx) ? (maxx - minx + 1) : 0;
+      if (ln->w > l.width)
+        l.width = ln->w;
+      if (maxy >= miny) {
+        if (miny < top)
+          top = miny;
+        if (maxy > bottom)
+          bottom = maxy;
+      }
+      y += adv;
+    } while (c && (l.lines < GFX_LAYOUT_MAX_LINES));
+
+    wrap = oldWrap;
+    l.y1 = (bottom >= top) ? top : 0;
+    l.height = (bottom >= top) ? (bottom - top + 1) : 0;
+    if (used < GFX_LAYOUT_CACHE_SIZE)
+      used++;
+    i = used - 1;
+  }
+
+  memmove(&cache[1], &cache[0], i * sizeof(GFXtextLayout));
+  cache[0] = l;
+  return &cache[0];
+}
+
+/**************************************************************************/
+/*!
+    @brief    Draw a flash string inside a box using the current font, size
+   and colors. The text is laid out with layoutText() to the box width, then
+   centred vertically and each line aligned left, centre or right. Nothing is
+   clipped to the box.
+    @param    str     The flash string to draw
+    @param    x       Left edge of the box
+    @param    y       Top edge of the box
+    @param    w       Width of the box
+    @param    h       Height of the box
+    @param    align   GFX_ALIGN_LEFT, GFX_ALIGN_CENTER or GFX_ALIGN_RIGHT
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawText(const __FlashStringHelper *str, int16_t x,
+                            int16_t y, int16_t w, int16_t h, uint8_t align) {
+  const GFXtextLayout *l = layoutText(str, w);
+  const uint8_t *s = (const uint8_t *)str;
+  int16_t adv = textsize_y * (gfxFont ? (uint8_t)pgm_read_byte(
+                                            &gfxFont->yAdvance)
+                                      : 8);
+  boolean oldWrap = wrap;
+
+  wrap = false;
+  y += h / 2 - (int16_t)(l->height / 2) - l->y1;
+  for (uint8_t i = 0; i < l->lines; i++, y += adv) {
+    const GFXtextLine *ln = &l->line[i];
+    int16_t cx = x - ln->x1;
+    if (align == GFX_ALIGN_CENTER)
+      cx += w / 2 - (int16_t)(ln->w / 2);
+    else if (align == GFX_ALIGN_RIGHT)
+      cx += w - (int16_t)ln->w;
+    setCursor(cx, y);
+    for (uint16_t j = 0; j < ln->len; j++)
+      write(pgm_read_byte(&s[ln->start + j]));
+  }
+  wrap = oldWrap;
+}
+
 /**************************************************************************/
 /*!
     @brief      Invert the display (ideally using built-in hardware command)
@@ -1813,6 +2674,39 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  Get the pixel color value at a given coordinate
+    @param  x   x coordinate
+    @param  y   y coordinate
+    @returns    true if the pixel is set, false if clear or out of bounds
+*/
+/**************************************************************************/
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+  if (!buffer || (x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    return false;
+
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = WIDTH - 1 - x;
+    y = HEIGHT - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - 1 - t;
+    break;
+  }
+
+  return buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+}
+
 /**************************************************************************/
 /*!
     @brief  Fill the framebuffer completely with one color
@@ -1826,6 +2720,81 @@ void GFXcanvas1::fillScreen(uint16_t color) {
   }
 }
 
+/**************************************************************************/
+/*!
+   @brief    Draw a horizontal line to the canvas framebuffer
+   @param    x   Left-most x coordinate
+   @param    y   y coordinate
+   @param    w   Width in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                               uint16_t color) {
+  if (w <= 0) { // As writeLine(x, y, x + w - 1, y): x + w - 1 through x
+    x += w - 1;
+    w = 2 - w;
+  }
+  GFXcanvas1::fillRect(x, y, w, 1, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a vertical line to the canvas framebuffer
+   @param    x   x coordinate
+   @param    y   Top-most y coordinate
+   @param    h   Height in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                               uint16_t color) {
+  GFXcanvas1::fillRect(x, y, 1, h, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Fill a rectangle in the canvas framebuffer. Each row is an edge
+             mask at either end with whole bytes set between them, so
+             narrow (vertical) fills just step a single mask down the rows.
+   @param    x   Top left corner x coordinate
+   @param    y   Top left corner y coordinate
+   @param    w   Width in pixels
+   @param    h   Height in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                          uint16_t color) {
+  if (!buffer || !rawRect(&x, &y, &w, &h))
+    return;
+
+  uint16_t bytesPerRow = (WIDTH + 7) / 8;
+  int16_t x2 = x + w - 1;
+  uint8_t *ptr = &buffer[(x / 8) + y * bytesPerRow];
+  uint8_t firstMask = 0xFF >> (x & 7), lastMask = 0xFF << (7 - (x2 & 7));
+  int16_t n = (x2 / 8) - (x / 8); // Bytes following the first one
+
+  if (!n)
+    firstMask &= lastMask;
+
+  for (; h--; ptr += bytesPerRow) {
+    if (color) {
+      *ptr |= firstMask;
+      if (n) {
+        memset(ptr + 1, 0xFF, n - 1);
+        ptr[n] |= lastMask;
+      }
+    } else {
+      *ptr &= ~firstMask;
+      if (n) {
+        memset(ptr + 1, 0x00, n - 1);
+        ptr[n] &= ~lastMask;
+      }
+    }
+  }
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX 8-bit canvas context for graphics
@@ -1897,42 +2866,120 @@ void GFXcanvas8::fillScreen(uint16_t color) {
   }
 }
 
-void GFXcanvas8::writeFastHLine(int16_t x, int16_t y, int16_t w,
-                                uint16_t color) {
+/**************************************************************************/
+/*!
+   @brief    Draw a horizontal line to the canvas framebuffer
+   @param    x   Left-most x coordinate
+   @param    y   y coordinate
+   @param    w   Width in pixels
+   @param    color 8-bit Color to fill with (lower byte of color)
+*/
+/**************************************************************************/
+void GFXcanvas8::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                               uint16_t color) {
+  if (w <= 0) { // As writeLine(x, y, x + w - 1, y): x + w - 1 through x
+    x += w - 1;
+    w = 2 - w;
+  }
+  GFXcanvas8::fillRect(x, y, w, 1, color);
+}
 
-  if ((x >= _width) || (y < 0) || (y >= _height))
-    return;
-  int16_t x2 = x + w - 1;
-  if (x2 < 0)
+/**************************************************************************/
+/*!
+   @brief    Draw a vertical line to the canvas framebuffer
+   @param    x   x coordinate
+   @param    y   Top-most y coordinate
+   @param    h   Height in pixels
+   @param    color 8-bit Color to fill with (lower byte of color)
+*/
+/**************************************************************************/
+void GFXcanvas8::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                               uint16_t color) {
+  GFXcanvas8::fillRect(x, y, 1, h, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Fill a rectangle in the canvas framebuffer, one memset() per row
+   @param    x   Top left corner x coordinate
+   @param    y   Top left corner y coordinate
+   @param    w   Width in pixels
+   @param    h   Height in pixels
+   @param    color 8-bit Color to fill with (lower byte of color)
+*/
+/**************************************************************************/
+void GFXcanvas8::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                          uint16_t color) {
+  if (!buffer || !rawRect(&x, &y, &w, &h))
     return;
 
-  // Clip left/right
-  if (x < 0) {
-    x = 0;
-    w = x2 + 1;
+  uint8_t *ptr = &buffer[(uint32_t)y * WIDTH + x];
+  if (w <= 4) { // Scaled glyph strokes; cheaper than a memset() call a row
+    for (; h--; ptr += WIDTH)
+      for (int16_t i = 0; i < w; i++)
+        ptr[i] = color;
+  } else {
+    for (; h--; ptr += WIDTH)
+      memset(ptr, color, w);
   }
-  if (x2 >= _width)
-    w = _width - x;
+}
 
-  int16_t t;
-  switch (rotation) {
-  case 1:
-    t = x;
-    x = WIDTH - 1 - y;
-    y = t;
-    break;
-  case 2:
-    x = WIDTH - 1 - x;
-    y = HEIGHT - 1 - y;
-    break;
-  case 3:
-    t = x;
-    x = y;
-    y = HEIGHT - 1 - t;
-    break;
+#ifdef GFX_ENABLE_AA_FONTS
+/**************************************************************************/
+/*!
+   @brief   Draw a single character. Anti-aliased fonts are blended as
+            3-3-2 RGB, the rest are left to Adafruit_GFX.
+    @param    x   Bottom left corner x coordinate
+    @param    y   Bottom left corner y coordinate
+    @param    c   The 8-bit font-indexed character (likely ascii), or a
+                  code point with a GFX_FONT_UTF8 font
+    @param    color 8-bit Color to draw character with
+    @param    bg 8-bit Color to fill background with (if same as color,
+   no background)
+    @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+    @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void GFXcanvas8::drawChar(int16_t x, int16_t y, uint16_t c,
+                          uint16_t color, uint16_t bg, uint8_t size_x,
+                          uint8_t size_y) {
+  if (!gfxFont ||
+      !(pgm_read_byte(&gfxFont->flags) & (GFX_FONT_AA2 | GFX_FONT_AA4))) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
   }
+  const GFXglyph *glyph = fontGlyph(c);
+  if (!glyph)
+    return;
 
-  memset(buffer + y * WIDTH + x, color, w);
+  uint16_t palette[16];
+  uint8_t r = (color >> 5) & 7, g = (color >> 2) & 7, b = color & 3;
+  uint8_t br = (bg >> 5) & 7, bgg = (bg >> 2) & 7, bb = bg & 3;
+  for (uint8_t a = 0; a < 16; a++) {
+    uint8_t na = 15 - a;
+    palette[a] = (((r * a + br * na + 7) / 15) << 5) |
+                 (((g * a + bgg * na + 7) / 15) << 2) |
+                 ((b * a + bb * na + 7) / 15);
+  }
+  drawGlyphAA(x, y, glyph, palette, bg != color, size_x, size_y);
+}
+#endif // GFX_ENABLE_AA_FONTS
+
+// Store n copies of a 16-bit color from dst onward. Where the target has
+// vector registers, the bulk of the span goes out a register at a time.
+static void fillWords(uint16_t *dst, uint16_t color, uint32_t n) {
+#if defined(__AVX2__)
+  __m256i v256 = _mm256_set1_epi16((short)color);
+  for (; n >= 16; n -= 16, dst += 16)
+    _mm256_storeu_si256((__m256i *)dst, v256);
+#endif
+#if defined(__SSE2__)
+  __m128i v128 = _mm_set1_epi16((short)color);
+  for (; n >= 8; n -= 8, dst += 8)
+    _mm_storeu_si128((__m128i *)dst, v128);
+#endif
+  while (n--)
+    *dst++ = color;
 }
 
 /**************************************************************************/
@@ -2006,9 +3053,7 @@ void GFXcanvas16::fillScreen(uint16_t color) {
     if (hi == lo) {
       memset(buffer, lo, WIDTH * HEIGHT * 2);
     } else {
-      uint32_t i, pixels = WIDTH * HEIGHT;
-      for (i = 0; i < pixels; i++)
-        buffer[i] = color;
+      fillWords(buffer, color, (uint32_t)WIDTH * HEIGHT);
     }
   }
 }
@@ -2028,8 +3073,79 @@ void GFXcanvas16::fillScreen(uint16_t color) {
 /**************************************************************************/
 void GFXcanvas16::byteSwap(void) {
   if (buffer) {
-    uint32_t i, pixels = WIDTH * HEIGHT;
-    for (i = 0; i < pixels; i++)
+    uint32_t i = 0, pixels = WIDTH * HEIGHT;
+#if defined(__AVX2__)
+    for (; i + 16 <= pixels; i += 16) {
+      __m256i *p = (__m256i *)&buffer[i], v = _mm256_loadu_si256(p);
+      _mm256_storeu_si256(
+          p, _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8)));
+    }
+#endif
+#if defined(__SSE2__)
+    for (; i + 8 <= pixels; i += 8) {
+      __m128i *p = (__m128i *)&buffer[i], v = _mm_loadu_si128(p);
+      _mm_storeu_si128(
+          p, _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    }
+#endif
+    for (; i < pixels; i++)
       buffer[i] = __builtin_bswap16(buffer[i]);
   }
 }
+
+/**************************************************************************/
+/*!
+   @brief    Draw a horizontal line to the canvas framebuffer
+   @param    x   Left-most x coordinate
+   @param    y   y coordinate
+   @param    w   Width in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                uint16_t color) {
+  if (w <= 0) { // As writeLine(x, y, x + w - 1, y): x + w - 1 through x
+    x += w - 1;
+    w = 2 - w;
+  }
+  GFXcanvas16::fillRect(x, y, w, 1, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a vertical line to the canvas framebuffer
+   @param    x   x coordinate
+   @param    y   Top-most y coordinate
+   @param    h   Height in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                uint16_t color) {
+  GFXcanvas16::fillRect(x, y, 1, h, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Fill a rectangle in the canvas framebuffer a row at a time
+   @param    x   Top left corner x coordinate
+   @param    y   Top left corner y coordinate
+   @param    w   Width in pixels
+   @param    h   Height in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas16::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color) {
+  if (!buffer || !rawRect(&x, &y, &w, &h))
+    return;
+
+  uint16_t *ptr = &buffer[(uint32_t)y * WIDTH + x];
+  if (w == 1) {
+    for (; h--; ptr += WIDTH)
+      *ptr = color;
+  } else {
+    for (; h--; ptr += WIDTH)
+      fillWords(ptr, color, w);
+  }
+}
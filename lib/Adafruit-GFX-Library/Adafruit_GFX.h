@@ -9,6 +9,64 @@
 #endif
 #include "gfxfont.h"
 
+// The sizes below are compiled into Adafruit_GFX.cpp, so a #define in a
+// sketch before including this header does not reach them. Change them as
+// build flags, e.g. build_flags = -DGFX_POLYGON_MAX_VERTICES=12 in
+// platformio.ini.
+
+#ifndef GFX_POLYGON_MAX_VERTICES
+/// Most vertices fillPolygon() will fill; its edge table lives on the
+/// stack. Polygons with more vertices are drawn as an outline.
+#define GFX_POLYGON_MAX_VERTICES 8
+#endif
+
+#ifndef GFX_LAYOUT_CACHE_SIZE
+/// Text layouts kept by layoutText() (at least 1), least recently used go.
+/// The cache is static RAM: on AVR each layout is 15 bytes plus 8 per line
+/// (GFX_LAYOUT_MAX_LINES), 117 bytes for the default 3 layouts of 3 lines.
+#define GFX_LAYOUT_CACHE_SIZE 3
+#endif
+
+#ifndef GFX_LAYOUT_MAX_LINES
+/// Most lines a text layout holds; text beyond the last line is dropped
+#define GFX_LAYOUT_MAX_LINES 3
+#endif
+
+// Decoders for the glyph formats fontconvert writes besides plain bits are
+// built only on request, as they cost flash in every sketch that prints
+// text whether or not it uses such a font. Glyphs of a format left out
+// draw nothing, though the text is laid out and advanced as usual.
+//   -DGFX_ENABLE_PACKED_FONTS  GFX_FONT_PACKED (fontconvert -z)
+//   -DGFX_ENABLE_PAGE_FONTS    GFX_FONT_PAGES (fontconvert -p)
+//   -DGFX_ENABLE_AA_FONTS      GFX_FONT_AA2 and GFX_FONT_AA4 (fontconvert -a)
+//   -DGFX_ENABLE_UTF8_FONTS    GFX_FONT_UTF8 (fontconvert -u); without it
+//                              text is a byte per character for every font
+
+/// Horizontal alignment of each line within the box given to drawText()
+enum { GFX_ALIGN_LEFT, GFX_ALIGN_CENTER, GFX_ALIGN_RIGHT };
+
+/// One line of a GFXtextLayout
+typedef struct {
+  uint16_t start; ///< Offset of the first character in the string
+  uint16_t len;   ///< Characters on the line, trailing spaces excluded
+  int16_t x1;     ///< Left edge of the ink relative to the cursor
+  uint16_t w;     ///< Width of the ink
+} GFXtextLine;
+
+/// Line breaks and bounds of a flash string, as computed by layoutText()
+typedef struct {
+  const __FlashStringHelper *str; ///< String laid out
+  const GFXfont *font;            ///< Font used, NULL for the classic font
+  uint8_t sizeX;                  ///< Text magnification in X used
+  uint8_t sizeY;                  ///< Text magnification in Y used
+  int16_t boxW;                   ///< Width the lines were broken to fit
+  int16_t y1;       ///< Top of the ink relative to the first line's cursor
+  uint16_t width;   ///< Width of the widest line
+  uint16_t height;  ///< Height of the ink over all lines
+  uint8_t lines;    ///< Number of lines used
+  GFXtextLine line[GFX_LAYOUT_MAX_LINES]; ///< The lines themselves
+} GFXtextLayout;
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -68,6 +126,7 @@ public:
                    int16_t y2, uint16_t color),
       fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
                    int16_t y2, uint16_t color),
+      fillPolygon(const int16_t *pts, uint8_t n, uint16_t color),
       drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
                     int16_t radius, uint16_t color),
       fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
@@ -82,6 +141,8 @@ public:
                  uint16_t color, uint16_t bg),
       drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
                   int16_t h, uint16_t color),
+      drawRLEBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                    int16_t h, uint16_t color),
       drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
                           int16_t w, int16_t h),
       drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
@@ -98,10 +159,8 @@ public:
                     const uint8_t mask[], int16_t w, int16_t h),
       drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, uint8_t *mask,
                     int16_t w, int16_t h),
-      drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
-               uint16_t bg, uint8_t size),
-      drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
-               uint16_t bg, uint8_t size_x, uint8_t size_y),
+      drawChar(int16_t x, int16_t y, uint16_t c, uint16_t color, uint16_t bg,
+               uint8_t size),
       getTextBounds(const char *string, int16_t x, int16_t y, int16_t *x1,
                     int16_t *y1, uint16_t *w, uint16_t *h),
       getTextBounds(const __FlashStringHelper *s, int16_t x, int16_t y,
@@ -111,6 +170,16 @@ public:
       setTextSize(uint8_t s), setTextSize(uint8_t sx, uint8_t sy),
       setFont(const GFXfont *f = NULL);
 
+  // May be overridden by displays that can render glyphs faster than
+  // Adafruit_GFX can by way of writePixel()/writeFillRect()
+  virtual void drawChar(int16_t x, int16_t y, uint16_t c, uint16_t color,
+                        uint16_t bg, uint8_t size_x, uint8_t size_y);
+
+  const GFXtextLayout *layoutText(const __FlashStringHelper *str,
+                                  int16_t boxW);
+  void drawText(const __FlashStringHelper *str, int16_t x, int16_t y,
+                int16_t w, int16_t h, uint8_t align = GFX_ALIGN_CENTER);
+
   /**********************************************************************/
   /*!
     @brief  Set text cursor location
@@ -220,8 +289,17 @@ public:
   int16_t getCursorY(void) const { return cursor_y; };
 
 protected:
-  void charBounds(char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny,
-                  int16_t *maxx, int16_t *maxy);
+  void charBounds(uint16_t c, int16_t *x, int16_t *y, int16_t *minx,
+                  int16_t *miny, int16_t *maxx, int16_t *maxy);
+  const uint8_t *classicGlyph(unsigned char c) const;
+  const GFXglyph *fontGlyph(uint16_t c) const;
+  const uint8_t *fontBitmap(const GFXglyph *glyph) const;
+#ifdef GFX_ENABLE_AA_FONTS
+  void drawGlyphAA(int16_t x, int16_t y, const GFXglyph *glyph,
+                   const uint16_t *palette, bool opaque, uint8_t size_x,
+                   uint8_t size_y);
+#endif
+  bool rawRect(int16_t *x, int16_t *y, int16_t *w, int16_t *h) const;
   int16_t WIDTH,      ///< This is the 'raw' display width - never changes
       HEIGHT;         ///< This is the 'raw' display height - never changes
   int16_t _width,     ///< Display width as modified by current rotation
@@ -236,6 +314,10 @@ protected:
   boolean wrap,       ///< If set, 'wrap' text at right edge of display
       _cp437;         ///< If set, use correct CP437 charset (default is off)
   GFXfont *gfxFont;   ///< Pointer to special font
+#ifdef GFX_ENABLE_UTF8_FONTS
+  uint16_t utf8Code;  ///< Code point being decoded by write()
+  uint8_t utf8More;   ///< UTF-8 continuation bytes write() still expects
+#endif
 };
 
 /// A simple drawn button UI element
@@ -302,7 +384,11 @@ public:
   GFXcanvas1(uint16_t w, uint16_t h);
   ~GFXcanvas1(void);
   void drawPixel(int16_t x, int16_t y, uint16_t color),
-      fillScreen(uint16_t color);
+      fillScreen(uint16_t color),
+      drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+      drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+      fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  bool getPixel(int16_t x, int16_t y) const;
   /**********************************************************************/
   /*!
     @brief    Get a pointer to the internal buffer memory
@@ -322,7 +408,14 @@ public:
   ~GFXcanvas8(void);
   void drawPixel(int16_t x, int16_t y, uint16_t color),
       fillScreen(uint16_t color),
-      writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+      drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+      drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+      fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+#ifdef GFX_ENABLE_AA_FONTS
+  using Adafruit_GFX::drawChar;
+  void drawChar(int16_t x, int16_t y, uint16_t c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y);
+#endif
   /**********************************************************************/
   /*!
    @brief    Get a pointer to the internal buffer memory
@@ -341,7 +434,10 @@ public:
   GFXcanvas16(uint16_t w, uint16_t h);
   ~GFXcanvas16(void);
   void drawPixel(int16_t x, int16_t y, uint16_t color),
-      fillScreen(uint16_t color), byteSwap(void);
+      fillScreen(uint16_t color), byteSwap(void),
+      drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+      drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+      fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
   /**********************************************************************/
   /*!
     @brief    Get a pointer to the internal buffer memory
@@ -921,6 +921,7 @@ void Adafruit_SPITFT::startWrite(void) {
             for all display types; not an SPI-specific function.
 */
 void Adafruit_SPITFT::endWrite(void) {
+  flushSpan();
   if (_cs >= 0)
     SPI_CS_HIGH();
   SPI_END_TRANSACTION();
@@ -942,10 +943,8 @@ void Adafruit_SPITFT::endWrite(void) {
     @param  color  16-bit pixel color in '565' RGB format.
 */
 void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color) {
-  if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
-    setAddrWindow(x, y, 1, 1);
-    SPI_WRITE16(color);
-  }
+  if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height))
+    writeSpan(x, y, 1, 1, color);
 }
 
 /*!
@@ -1558,8 +1557,118 @@ void inline Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h,
 inline void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y,
                                                      int16_t w, int16_t h,
                                                      uint16_t color) {
-  setAddrWindow(x, y, w, h);
-  writeColor(color, (uint32_t)w * h);
+  if (fillH && (x == spanX) && (w == fillW) && (y == spanY + fillH) &&
+      (color == fillColor)) {
+    fillH += h; // Continues the held fill downward, one burst for both
+  } else if (((h == 1) || (w == 1)) && (w * h <= SPITFT_SPAN_PIXELS)) {
+    writeSpan(x, y, w, h, color);
+  } else {
+    flushSpan();
+    spanX = x;
+    spanY = y;
+    fillW = w;
+    fillH = h;
+    fillColor = color;
+  }
+}
+
+/*!
+    @brief  Hold a one-row or one-column span of pixels to send later,
+            together with any spans that continue it along the row or down
+            the column. Text, circles, lines and the like draw as many
+            short spans, each of which would otherwise need an address
+            window of its own, and the window commands cost more than the
+            pixels. NO CLIPPING IS PERFORMED.
+    @param  x      Horizontal position of first pixel, on screen.
+    @param  y      Vertical position of first pixel, on screen.
+    @param  w      Span width in pixels, 1 if h is more.
+    @param  h      Span height in pixels, 1 if w is more. w * h is 1 to
+                   SPITFT_SPAN_PIXELS and the span is wholly on screen.
+    @param  color  16-bit span color in '565' RGB format.
+*/
+inline void Adafruit_SPITFT::writeSpan(int16_t x, int16_t y, int16_t w,
+                                       int16_t h, uint16_t color) {
+  uint8_t n = w * h;
+  if (fillH) {
+    flushSpan();
+  } else if (spanLen) {
+    if ((spanLen == 1) && (w == 1) && (x == spanX) && (y == spanY + 1))
+      spanDown = true; // Second pixel decides which way the span runs
+    if ((spanDown ? ((w != 1) || (x != spanX) || (y != spanY + spanLen))
+                  : ((h != 1) || (y != spanY) || (x != spanX + spanLen))) ||
+        (spanLen + n > SPITFT_SPAN_PIXELS))
+      flushSpan();
+  }
+  if (!spanLen) {
+    spanX = x;
+    spanY = y;
+    spanDown = (h > 1);
+  }
+  uint16_t *p = &spanBuf[spanLen];
+  spanLen += n;
+  while (n--)
+    *p++ = color;
+}
+
+/*!
+    @brief  Send the span or fill held by writePixel(), writeFastHLine(),
+            writeFastVLine() and writeFillRect() through one address
+            window. endWrite() and the functions here that set their own
+            window or send a command do this first, so it is only needed
+            before calling setAddrWindow() or writeCommand() directly inside
+            a startWrite()/endWrite() pair that has also used those.
+*/
+void Adafruit_SPITFT::flushSpan(void) {
+  if (fillH) {
+    int16_t h = fillH;
+    fillH = 0;
+    setAddrWindow(spanX, spanY, fillW, h);
+    writeColor(fillColor, (uint32_t)fillW * h);
+  } else if (spanLen) {
+    uint8_t n = spanLen;
+    spanLen = 0;
+    if (spanDown)
+      setAddrWindow(spanX, spanY, 1, n);
+    else
+      setAddrWindow(spanX, spanY, n, 1);
+    writePixels(spanBuf, n);
+  }
+}
+
+/*!
+    @brief  Set the address window of a MIPI DCS controller (ILI9341,
+            ST77xx, HX8357 and most others here) and start a memory write,
+            for subclasses' setAddrWindow() to call. The column and row
+            ranges last sent are remembered, and a CASET or RASET that
+            would repeat them is skipped: runs of pixels along one row or
+            down one column, as circles and text draw, then need only half
+            the window commands. Any other command forgets them. Chip-
+            select and transaction must have been previously set.
+    @param  x1  First column, in the controller's own coordinates.
+    @param  y1  First row.
+    @param  x2  Last column.
+    @param  y2  Last row.
+*/
+void Adafruit_SPITFT::writeAddrWindow(uint16_t x1, uint16_t y1, uint16_t x2,
+                                      uint16_t y2) {
+  bool cols = !winValid || (x1 != winX1) || (x2 != winX2),
+       rows = !winValid || (y1 != winY1) || (y2 != winY2);
+  if (cols) {
+    writeCommand(0x2A); // CASET
+    SPI_WRITE16(x1);
+    SPI_WRITE16(x2);
+  }
+  if (rows) {
+    writeCommand(0x2B); // RASET
+    SPI_WRITE16(y1);
+    SPI_WRITE16(y2);
+  }
+  writeCommand(0x2C); // RAMWR
+  winX1 = x1;
+  winX2 = x2;
+  winY1 = y1;
+  winY2 = y2;
+  winValid = true;
 }
 
 // -------------------------------------------------------------------------
@@ -1584,6 +1693,7 @@ void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
   if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
     // THEN set up transaction (if needed) and draw...
     startWrite();
+    flushSpan();
     setAddrWindow(x, y, 1, 1);
     SPI_WRITE16(color);
     endWrite();
@@ -1743,6 +1853,7 @@ void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h,
 */
 void Adafruit_SPITFT::pushColor(uint16_t color) {
   startWrite();
+  flushSpan();
   SPI_WRITE16(color);
   endWrite();
 }
@@ -1792,6 +1903,7 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors,
 
   pcolors += by1 * saveW + bx1; // Offset bitmap ptr to clipped top-left
   startWrite();
+  flushSpan();
   setAddrWindow(x, y, w, h); // Clipped area
   while (h--) {              // For each (clipped) scanline...
     writePixels(pcolors, w); // Push one (clipped) row
@@ -1800,6 +1912,52 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors,
   endWrite();
 }
 
+/*!
+    @brief  Draw a single character. An opaque character of the built-in
+            'classic' font that is wholly on screen is built a row at a
+            time in the span buffer and sent through one address window
+            for the whole cell; anything else goes through
+            Adafruit_GFX::drawChar().
+    @param  x       Top left corner horizontal coordinate.
+    @param  y       Top left corner vertical coordinate.
+    @param  c       The 8-bit font-indexed character (likely ascii), or a
+                    code point with a GFX_FONT_UTF8 font.
+    @param  color   16-bit character color in '565' RGB format.
+    @param  bg      16-bit background color, same as color for none.
+    @param  size_x  Font magnification level in X-axis, 1 is 'original' size.
+    @param  size_y  Font magnification level in Y-axis, 1 is 'original' size.
+*/
+void Adafruit_SPITFT::drawChar(int16_t x, int16_t y, uint16_t c,
+                               uint16_t color, uint16_t bg, uint8_t size_x,
+                               uint8_t size_y) {
+  int16_t w = 6 * size_x, h = 8 * size_y;
+  if (gfxFont || (bg == color) || !w || !h || (w > SPITFT_SPAN_PIXELS) ||
+      (x < 0) || (y < 0) || (x + w > _width) || (y + h > _height)) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+
+  const uint8_t *glyph = classicGlyph(c);
+  uint8_t line[5];
+  for (uint8_t i = 0; i < 5; i++)
+    line[i] = pgm_read_byte(&glyph[i]);
+
+  startWrite();
+  flushSpan();
+  setAddrWindow(x, y, w, h);
+  for (uint8_t j = 0; j < 8; j++) {
+    uint16_t *p = spanBuf;
+    for (uint8_t i = 0; i < 6; i++) { // Last column is blank
+      uint16_t px = ((i < 5) && (line[i] & (1 << j))) ? color : bg;
+      for (uint8_t k = size_x; k--;)
+        *p++ = px;
+    }
+    for (uint8_t k = size_y; k--;)
+      writePixels(spanBuf, w);
+  }
+  endWrite();
+}
+
 // -------------------------------------------------------------------------
 // Miscellaneous class member functions that don't draw anything.
 
@@ -1810,6 +1968,7 @@ void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors,
 */
 void Adafruit_SPITFT::invertDisplay(bool i) {
   startWrite();
+  flushSpan();
   writeCommand(i ? invertOnCommand : invertOffCommand);
   endWrite();
 }
@@ -1837,6 +1996,7 @@ data
 */
 void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t *dataBytes,
                                   uint8_t numDataBytes) {
+  flushSpan();
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
@@ -1869,6 +2029,7 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, uint8_t *dataBytes,
  */
 void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
                                   uint8_t numDataBytes) {
+  flushSpan();
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
@@ -1905,6 +2066,7 @@ void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
 void Adafruit_SPITFT::sendCommand16(uint16_t commandWord,
                                     const uint8_t *dataBytes,
                                     uint8_t numDataBytes) {
+  flushSpan();
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
@@ -1941,6 +2103,7 @@ void Adafruit_SPITFT::sendCommand16(uint16_t commandWord,
 uint8_t Adafruit_SPITFT::readcommand8(uint8_t commandByte, uint8_t index) {
   uint8_t result;
   startWrite();
+  flushSpan();
   SPI_DC_LOW(); // Command mode
   spiWrite(commandByte);
   SPI_DC_HIGH(); // Data mode
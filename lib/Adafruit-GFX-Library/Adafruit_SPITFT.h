@@ -65,6 +65,16 @@ typedef uint32_t ADAGFX_PORT_t; ///< PORT values are 32-bit
 #endif                                     // end !ARM
 typedef volatile ADAGFX_PORT_t *PORTreg_t; ///< PORT register type
 
+/// Pixels of one-row or one-column spans held to be sent together, see
+/// flushSpan(); also the widest character cell drawChar() sends through a
+/// single window. At most 255, as spans are counted in a byte.
+#ifndef SPITFT_SPAN_PIXELS
+#define SPITFT_SPAN_PIXELS 32
+#endif
+#if (SPITFT_SPAN_PIXELS < 1) || (SPITFT_SPAN_PIXELS > 255)
+#error "SPITFT_SPAN_PIXELS must be 1 to 255"
+#endif
+
 #if defined(__AVR__)
 #define DEFAULT_SPI_FREQ 8000000L ///< Hardware SPI default speed
 #else
@@ -227,6 +237,11 @@ public:
   // Another new function, companion to the new non-blocking
   // writePixels() variant.
   void dmaWait(void);
+  // Send the spans and fills held by writePixel() and friends. endWrite()
+  // does this; only needed before calling setAddrWindow() or
+  // writeCommand() directly inside a startWrite()/endWrite() pair that
+  // also used those.
+  void flushSpan(void);
 
   // These functions are similar to the 'write' functions above, but with
   // a chip-select and/or SPI transaction built-in. They're typically used
@@ -244,6 +259,9 @@ public:
   using Adafruit_GFX::drawRGBBitmap; // Check base class first
   void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w,
                      int16_t h);
+  using Adafruit_GFX::drawChar;
+  void drawChar(int16_t x, int16_t y, uint16_t c, uint16_t color, uint16_t bg,
+                uint8_t size_x, uint8_t size_y);
 
   void invertDisplay(bool i);
   uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
@@ -340,6 +358,7 @@ public:
       @brief  Set the data/command line LOW (command mode).
   */
   void SPI_DC_LOW(void) {
+    winValid = false; // Any command may move the address window
 #if defined(USE_FAST_PINIO)
 #if defined(HAS_PORT_SET_CLR)
 #if defined(KINETISK)
@@ -371,6 +390,12 @@ protected:
   inline void TFT_WR_STROBE(void); // Parallel interface write strobe
   inline void TFT_RD_HIGH(void);   // Parallel interface read high
   inline void TFT_RD_LOW(void);    // Parallel interface read low
+  inline void writeSpan(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+  // For subclasses' setAddrWindow() on MIPI DCS controllers (ILI9341,
+  // ST77xx, HX8357...): CASET, RASET and RAMWR, skipping whichever of
+  // the first two would repeat what the controller already holds.
+  void writeAddrWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
 
   // CLASS INSTANCE VARIABLES --------------------------------------------
 
@@ -515,6 +540,20 @@ protected:
   uint8_t invertOffCommand = 0; ///< Command to disable invert mode
 
   uint32_t _freq = 0; ///< Dummy var to keep subclasses happy
+
+  uint16_t spanBuf[SPITFT_SPAN_PIXELS]; ///< Held span / character row
+  int16_t spanX;                        ///< Left of the held span or fill
+  int16_t spanY;                        ///< Top of the held span or fill
+  uint8_t spanLen = 0;                  ///< Pixels held in spanBuf
+  bool spanDown;                        ///< Held span is a column
+  int16_t fillW;                        ///< Width of the held fill
+  int16_t fillH = 0;                    ///< Height of the held fill, or 0
+  uint16_t fillColor;                   ///< Color of the held fill
+  uint16_t winX1;       ///< First column writeAddrWindow() last set
+  uint16_t winX2;       ///< Last column writeAddrWindow() last set
+  uint16_t winY1;       ///< First row writeAddrWindow() last set
+  uint16_t winY2;       ///< Last row writeAddrWindow() last set
+  bool winValid = false; ///< Set while the win* values are the controller's
 };
 
 #endif // end __AVR_ATtiny85__
@@ -0,0 +1,768 @@
+/*!
+ * @file Adafruit_SPITFT_Tiles.cpp
+ *
+ * Part of Adafruit's GFX graphics library. A display list for
+ * Adafruit_SPITFT panels, for MCUs without the RAM for a framebuffer:
+ * drawing is recorded rather than sent, and display() then renders the
+ * screen one small tile at a time, sending only the tiles whose drawing
+ * changed since the last frame.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#if !defined(__AVR_ATtiny85__) // Not for ATtiny, at all
+
+#include "Adafruit_SPITFT_Tiles.h"
+
+// Display list commands: an op byte, then 16-bit fields LSB first
+enum {
+  TILE_RECT,       // x, y, w, h, color
+  TILE_LINE,       // x0, y0, x1, y1, color
+  TILE_ROUND,      // x, y, w, h, r, color: drawRoundRect()
+  TILE_FILL_ROUND, // x, y, w, h, r, color: fillRoundRect()
+  TILE_PIXEL,      // x, y, color
+  TILE_STYLE,      // color, bg, size_x (byte), size_y (byte), font pointer
+  TILE_TEXT,       // x, y, ink x0, y0, x1, y1, count (byte), characters
+  TILE_BITMAP,     // x, y, w, h, color, bitmap pointer
+  TILE_BITMAP_BG,  // x, y, w, h, color, bg, bitmap pointer
+  TILE_RGB         // x, y, w, h, bitmap pointer
+};
+
+#define TILE_PTR sizeof(void *) ///< Bytes of a pointer in a command
+#define TILE_TEXT_HEADER 14     ///< Bytes of a text command before its chars
+
+static inline void put16(uint8_t *p, int16_t v) {
+  p[0] = v;
+  p[1] = (uint16_t)v >> 8;
+}
+
+static inline int16_t get16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+static inline const void *getPtr(const uint8_t *p) {
+  const void *ptr;
+  memcpy(&ptr, p, sizeof ptr);
+  return ptr;
+}
+
+static inline const GFXfont *styleFontOf(const uint8_t *style) {
+  return style ? (const GFXfont *)getPtr(&style[7]) : NULL;
+}
+
+// Characters are 2 bytes in text commands for GFX_FONT_UTF8 fonts
+static inline uint8_t charBytes(const GFXfont *font) {
+  return (font && (pgm_read_byte(&font->flags) & GFX_FONT_UTF8)) ? 2 : 1;
+}
+
+// 32-bit FNV-1a: a 16-bit or multiply-add hash lets small edits to
+// neighboring bytes, such as one character and the next, cancel out
+static uint32_t hashBytes(uint32_t hash, const uint8_t *p, uint16_t len) {
+  while (len--)
+    hash = (hash ^ *p++) * 16777619UL;
+  return hash;
+}
+
+static uint16_t commandLength(const uint8_t *p, const uint8_t *style) {
+  switch (p[0]) {
+  case TILE_RECT:
+  case TILE_LINE:
+    return 11;
+  case TILE_ROUND:
+  case TILE_FILL_ROUND:
+    return 13;
+  case TILE_PIXEL:
+    return 7;
+  case TILE_STYLE:
+    return 7 + TILE_PTR;
+  case TILE_TEXT:
+    return TILE_TEXT_HEADER + p[13] * charBytes(styleFontOf(style));
+  case TILE_BITMAP:
+    return 11 + TILE_PTR;
+  case TILE_BITMAP_BG:
+    return 13 + TILE_PTR;
+  default: // TILE_RGB
+    return 9 + TILE_PTR;
+  }
+}
+
+/*!
+    @brief  Instatiate a display list for a panel. The panel's size and
+            rotation at this point are the list's; don't rotate either
+            afterward.
+    @param  tft        Panel, begun, that display() sends tiles to.
+    @param  listBytes  Display list size. A frame that doesn't fit is
+                       drawn straight to the panel from where it overflows.
+    @param  tileW      Tile width in pixels, 0 for SPITFT_TILE_SIZE.
+    @param  tileH      Tile height in pixels, 0 for SPITFT_TILE_SIZE.
+    @param  bandH      Tile rows rendered and sent at a time, 0 or more
+                       than tileH for the whole tile. Fewer rows use less
+                       RAM but replay the list more times per tile.
+*/
+GFXtiles::GFXtiles(Adafruit_SPITFT *tft, uint16_t listBytes, uint8_t tileW,
+                   uint8_t tileH, uint8_t bandH)
+    : Adafruit_GFX(tft->width(), tft->height()), tft(tft), run(NULL),
+      listLen(0), bgColor(0), tileW(tileW ? tileW : SPITFT_TILE_SIZE),
+      tileH(tileH ? tileH : SPITFT_TILE_SIZE), styled(false), drawing(false),
+      dirty(true), direct(false) {
+  this->bandH = (bandH && (bandH < this->tileH)) ? bandH : this->tileH;
+  uint16_t tiles = ((_width + this->tileW - 1) / this->tileW) *
+                   ((_height + this->tileH - 1) / this->tileH);
+  list = (uint8_t *)malloc(listBytes);
+  listSize = list ? listBytes : 0;
+  tile = (uint16_t *)malloc(this->tileW * this->bandH * 2);
+  hashes = (uint32_t *)malloc(tiles * 4);
+}
+
+/*!
+    @brief  Delete the display list, free memory
+*/
+GFXtiles::~GFXtiles(void) {
+  if (list)
+    free(list);
+  if (tile)
+    free(tile);
+  if (hashes)
+    free(hashes);
+}
+
+/*!
+    @brief  Add a command to the end of the display list.
+    @param  op     TILE_* command.
+    @param  bytes  Command length including op.
+    @returns       Pointer to the command, its op byte set, or NULL if the
+                   list is full. The first time it fills in a frame, the
+                   list is sent with spill(); the caller then draws to the
+                   panel itself if direct is set.
+*/
+uint8_t *GFXtiles::record(uint8_t op, uint16_t bytes) {
+  run = NULL; // Anything after a text run ends it
+  if (direct)
+    return NULL;
+  if (listLen + bytes > listSize) {
+    spill();
+    return NULL;
+  }
+  uint8_t *p = &list[listLen];
+  listLen += bytes;
+  p[0] = op;
+  return p;
+}
+
+/*!
+    @brief  Send every tile with the drawing recorded so far, and draw the
+            rest of the frame straight to the panel. Everything drawn
+            still lands in order, at the cost of the tiles showing this
+            part-drawn frame for a moment.
+*/
+void GFXtiles::spill(void) {
+  if (!tile || !hashes)
+    return;
+  sendTiles(true);
+  listLen = 0;
+  styled = false;
+  direct = true;
+}
+
+/*!
+    @brief  Draw a pixel: render it into the tile, or record it.
+    @param  x      x coordinate
+    @param  y      y coordinate
+    @param  color  16-bit 5-6-5 Color to draw with
+*/
+void GFXtiles::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    return;
+  if (drawing) {
+    tile[y * _width + x] = color;
+  } else if (uint8_t *p = record(TILE_PIXEL, 7)) {
+    put16(&p[1], x);
+    put16(&p[3], y);
+    put16(&p[5], color);
+  } else if (direct) {
+    tft->drawPixel(x, y, color);
+  }
+}
+
+/*!
+    @brief  Start a new frame: clear the display list and set the color
+            every tile starts from
+    @param  color  16-bit 5-6-5 Color to fill with
+*/
+void GFXtiles::fillScreen(uint16_t color) {
+  if (direct) { // Last frame overflowed and was never display()ed
+    direct = false;
+    dirty = true;
+  }
+  listLen = 0;
+  run = NULL;
+  styled = false;
+  bgColor = color;
+}
+
+/*!
+    @brief  Draw a perfectly horizontal line
+    @param  x      Left-most x coordinate
+    @param  y      Left-most y coordinate
+    @param  w      Width in pixels
+    @param  color  16-bit 5-6-5 Color to fill with
+*/
+void GFXtiles::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                             uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+/*!
+    @brief  Draw a perfectly vertical line
+    @param  x      Top-most x coordinate
+    @param  y      Top-most y coordinate
+    @param  h      Height in pixels
+    @param  color  16-bit 5-6-5 Color to fill with
+*/
+void GFXtiles::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                             uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+/*!
+    @brief  Fill a rectangle: render it into the tile, or record it
+            clipped to the screen.
+    @param  x      Top left corner x coordinate
+    @param  y      Top left corner y coordinate
+    @param  w      Width in pixels
+    @param  h      Height in pixels
+    @param  color  16-bit 5-6-5 Color to fill with
+*/
+void GFXtiles::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color) {
+  if (x < 0) { // Clip left
+    w += x;
+    x = 0;
+  }
+  if (y < 0) { // Clip top
+    h += y;
+    y = 0;
+  }
+  if (x + w > _width) // Clip right
+    w = _width - x;
+  if (y + h > _height) // Clip bottom
+    h = _height - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+  if (drawing) {
+    for (uint16_t *row = &tile[y * _width + x]; h--; row += _width) {
+      for (int16_t i = 0; i < w; i++)
+        row[i] = color;
+    }
+  } else if (uint8_t *p = record(TILE_RECT, 11)) {
+    put16(&p[1], x);
+    put16(&p[3], y);
+    put16(&p[5], w);
+    put16(&p[7], h);
+    put16(&p[9], color);
+  } else if (direct) {
+    tft->fillRect(x, y, w, h, color);
+  }
+}
+
+/*!
+    @brief  Write a line: render it into the tile, or record it.
+    @param  x0     Start point x coordinate
+    @param  y0     Start point y coordinate
+    @param  x1     End point x coordinate
+    @param  y1     End point y coordinate
+    @param  color  16-bit 5-6-5 Color to draw with
+*/
+void GFXtiles::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                         uint16_t color) {
+  if (drawing) {
+    Adafruit_GFX::writeLine(x0, y0, x1, y1, color);
+  } else if ((x0 == x1) || (y0 == y1)) {
+    fillRect(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1,
+             color);
+  } else if ((max(x0, x1) >= 0) && (max(y0, y1) >= 0) &&
+             (min(x0, x1) < _width) && (min(y0, y1) < _height)) {
+    if (uint8_t *p = record(TILE_LINE, 11)) {
+      put16(&p[1], x0);
+      put16(&p[3], y0);
+      put16(&p[5], x1);
+      put16(&p[7], y1);
+      put16(&p[9], color);
+    } else if (direct) {
+      tft->drawLine(x0, y0, x1, y1, color);
+    }
+  }
+}
+
+/*!
+    @brief  Record a rounded rectangle. Shapes Adafruit_GFX would draw
+            oddly (no width or height, a negative radius) are left to it.
+    @param  op     TILE_ROUND or TILE_FILL_ROUND.
+    @param  x      Top left corner x coordinate
+    @param  y      Top left corner y coordinate
+    @param  w      Width in pixels
+    @param  h      Height in pixels
+    @param  r      Radius of corner rounding
+    @param  color  16-bit 5-6-5 Color to draw with
+*/
+void GFXtiles::roundRect(uint8_t op, int16_t x, int16_t y, int16_t w,
+                         int16_t h, int16_t r, uint16_t color) {
+  if (drawing || (w <= 0) || (h <= 0) || (r < 0)) {
+    if (op == TILE_ROUND)
+      Adafruit_GFX::drawRoundRect(x, y, w, h, r, color);
+    else
+      Adafruit_GFX::fillRoundRect(x, y, w, h, r, color);
+  } else if ((x + w <= 0) || (y + h <= 0) || (x >= _width) ||
+             (y >= _height)) {
+    return;
+  } else if (uint8_t *p = record(op, 13)) {
+    put16(&p[1], x);
+    put16(&p[3], y);
+    put16(&p[5], w);
+    put16(&p[7], h);
+    put16(&p[9], r);
+    put16(&p[11], color);
+  } else if (direct) {
+    if (op == TILE_ROUND)
+      tft->drawRoundRect(x, y, w, h, r, color);
+    else
+      tft->fillRoundRect(x, y, w, h, r, color);
+  }
+}
+
+/*!
+    @brief  Draw a circle outline, recorded as the rounded square of the
+            same pixels
+    @param  x0     Center-point x coordinate
+    @param  y0     Center-point y coordinate
+    @param  r      Radius of circle
+    @param  color  16-bit 5-6-5 Color to draw with
+*/
+void GFXtiles::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  if (r < 0)
+    Adafruit_GFX::drawCircle(x0, y0, r, color);
+  else
+    roundRect(TILE_ROUND, x0 - r, y0 - r, 2 * r + 1, 2 * r + 1, r, color);
+}
+
+/*!
+    @brief  Draw a filled circle, recorded as the rounded square of the
+            same pixels
+    @param  x0     Center-point x coordinate
+    @param  y0     Center-point y coordinate
+    @param  r      Radius of circle
+    @param  color  16-bit 5-6-5 Color to fill with
+*/
+void GFXtiles::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  if (r < 0)
+    Adafruit_GFX::fillCircle(x0, y0, r, color);
+  else
+    roundRect(TILE_FILL_ROUND, x0 - r, y0 - r, 2 * r + 1, 2 * r + 1, r,
+              color);
+}
+
+/*!
+    @brief  Draw a rounded rectangle with no fill color
+    @param  x      Top left corner x coordinate
+    @param  y      Top left corner y coordinate
+    @param  w      Width in pixels
+    @param  h      Height in pixels
+    @param  r      Radius of corner rounding
+    @param  color  16-bit 5-6-5 Color to draw with
+*/
+void GFXtiles::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             int16_t r, uint16_t color) {
+  roundRect(TILE_ROUND, x, y, w, h, r, color);
+}
+
+/*!
+    @brief  Draw a rounded rectangle with fill color
+    @param  x      Top left corner x coordinate
+    @param  y      Top left corner y coordinate
+    @param  w      Width in pixels
+    @param  h      Height in pixels
+    @param  r      Radius of corner rounding
+    @param  color  16-bit 5-6-5 Color to draw/fill with
+*/
+void GFXtiles::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             int16_t r, uint16_t color) {
+  roundRect(TILE_FILL_ROUND, x, y, w, h, r, color);
+}
+
+/*!
+    @brief  Distance the cursor moves past a character of the current font
+    @param  c       The character, as given to drawChar()
+    @param  size_x  Font magnification level in X-axis
+    @returns        Advance in pixels
+*/
+int16_t GFXtiles::advance(uint16_t c, uint8_t size_x) const {
+  if (!gfxFont)
+    return 6 * size_x;
+  const GFXglyph *glyph = fontGlyph(c);
+  return glyph ? pgm_read_byte(&glyph->xAdvance) * size_x : 0;
+}
+
+/*!
+    @brief  Record a single character. Characters that continue a line of
+            text in the same style join one command.
+    @param  x       Top left corner x coordinate (baseline with a custom
+                    font)
+    @param  y       Top left corner y coordinate (baseline with a custom
+                    font)
+    @param  c       The 8-bit font-indexed character (likely ascii), or a
+                    code point with a GFX_FONT_UTF8 font
+    @param  color   16-bit 5-6-5 Color to draw character with
+    @param  bg      16-bit 5-6-5 Color to fill background with (if same as
+                    color, no background)
+    @param  size_x  Font magnification level in X-axis, 1 is 'original' size
+    @param  size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+void GFXtiles::drawChar(int16_t x, int16_t y, uint16_t c, uint16_t color,
+                        uint16_t bg, uint8_t size_x, uint8_t size_y) {
+  if (drawing) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+  if (direct) { // Rects and pixels to the panel, leaving its font alone
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+
+  // Ink bounds, which is all a custom font glyph touches even opaque
+  int16_t x0 = x, y0 = y, x1 = x + 6 * size_x - 1, y1 = y + 8 * size_y - 1;
+  if (gfxFont) {
+    const GFXglyph *glyph = fontGlyph(c);
+    if (!glyph)
+      return;
+    uint8_t w = pgm_read_byte(&glyph->width),
+            h = pgm_read_byte(&glyph->height);
+    x0 += (int8_t)pgm_read_byte(&glyph->xOffset) * size_x;
+    y0 += (int8_t)pgm_read_byte(&glyph->yOffset) * size_y;
+    x1 = x0 + w * size_x - 1;
+    y1 = y0 + h * size_y - 1;
+  }
+  if ((x1 < x0) || (y1 < y0) || (x1 < 0) || (y1 < 0) || (x0 >= _width) ||
+      (y0 >= _height))
+    return;
+
+  if (!styled || (color != styleColor) || (bg != styleBg) ||
+      (size_x != styleX) || (size_y != styleY) || (gfxFont != styleFont)) {
+    uint8_t *p = record(TILE_STYLE, 7 + TILE_PTR);
+    if (!p) {
+      if (direct)
+        drawChar(x, y, c, color, bg, size_x, size_y);
+      return;
+    }
+    put16(&p[1], color);
+    put16(&p[3], bg);
+    p[5] = size_x;
+    p[6] = size_y;
+    memcpy(&p[7], &gfxFont, TILE_PTR);
+    styleColor = color;
+    styleBg = bg;
+    styleX = size_x;
+    styleY = size_y;
+    styleFont = gfxFont;
+    styled = true;
+  }
+
+  uint8_t n = charBytes(gfxFont);
+  if (run && (x == runNextX) && (y == get16(&run[3])) && (run[13] < 255) &&
+      (listLen + n <= listSize)) {
+    x0 = min(x0, get16(&run[5]));
+    y0 = min(y0, get16(&run[7]));
+    x1 = max(x1, get16(&run[9]));
+    y1 = max(y1, get16(&run[11]));
+    listLen += n;
+  } else {
+    if (!(run = record(TILE_TEXT, TILE_TEXT_HEADER + n))) {
+      if (direct)
+        drawChar(x, y, c, color, bg, size_x, size_y);
+      return;
+    }
+    put16(&run[1], x);
+    put16(&run[3], y);
+    run[13] = 0;
+  }
+  put16(&run[5], x0);
+  put16(&run[7], y0);
+  put16(&run[9], x1);
+  put16(&run[11], y1);
+  uint8_t *ch = &list[listLen - n];
+  ch[0] = c;
+  if (n > 1)
+    ch[1] = c >> 8;
+  run[13]++;
+  runNextX = x + advance(c, size_x);
+}
+
+/*!
+    @brief  Record a PROGMEM-resident 1-bit image, unset bits transparent
+    @param  x       Top left corner x coordinate
+    @param  y       Top left corner y coordinate
+    @param  bitmap  byte array with monochrome bitmap
+    @param  w       Width of bitmap in pixels
+    @param  h       Height of bitmap in pixels
+    @param  color   16-bit 5-6-5 Color to draw with
+*/
+void GFXtiles::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color) {
+  if ((w <= 0) || (h <= 0))
+    return;
+  if (uint8_t *p = record(TILE_BITMAP, 11 + TILE_PTR)) {
+    put16(&p[1], x);
+    put16(&p[3], y);
+    put16(&p[5], w);
+    put16(&p[7], h);
+    put16(&p[9], color);
+    memcpy(&p[11], &bitmap, TILE_PTR);
+  } else if (direct) {
+    tft->drawBitmap(x, y, bitmap, w, h, color);
+  }
+}
+
+/*!
+    @brief  Record a PROGMEM-resident 1-bit image with a background color
+    @param  x       Top left corner x coordinate
+    @param  y       Top left corner y coordinate
+    @param  bitmap  byte array with monochrome bitmap
+    @param  w       Width of bitmap in pixels
+    @param  h       Height of bitmap in pixels
+    @param  color   16-bit 5-6-5 Color to draw pixels with
+    @param  bg      16-bit 5-6-5 Color to draw background with
+*/
+void GFXtiles::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color,
+                          uint16_t bg) {
+  if ((w <= 0) || (h <= 0))
+    return;
+  if (uint8_t *p = record(TILE_BITMAP_BG, 13 + TILE_PTR)) {
+    put16(&p[1], x);
+    put16(&p[3], y);
+    put16(&p[5], w);
+    put16(&p[7], h);
+    put16(&p[9], color);
+    put16(&p[11], bg);
+    memcpy(&p[13], &bitmap, TILE_PTR);
+  } else if (direct) {
+    tft->drawBitmap(x, y, bitmap, w, h, color, bg);
+  }
+}
+
+/*!
+    @brief  Record a PROGMEM-resident 16-bit image
+    @param  x       Top left corner x coordinate
+    @param  y       Top left corner y coordinate
+    @param  bitmap  byte array with 16-bit color bitmap
+    @param  w       Width of bitmap in pixels
+    @param  h       Height of bitmap in pixels
+*/
+void GFXtiles::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                             int16_t w, int16_t h) {
+  if ((w <= 0) || (h <= 0))
+    return;
+  if (uint8_t *p = record(TILE_RGB, 9 + TILE_PTR)) {
+    put16(&p[1], x);
+    put16(&p[3], y);
+    put16(&p[5], w);
+    put16(&p[7], h);
+    memcpy(&p[9], &bitmap, TILE_PTR);
+  } else if (direct) {
+    tft->drawRGBBitmap(x, y, bitmap, w, h);
+  }
+}
+
+/*!
+    @brief  Render one command into the tile. The tile is the screen while
+            drawing, its origin moved to the tile's corner, so everything
+            Adafruit_GFX draws clips to the tile.
+    @param  p      The command.
+    @param  style  Last style command before it, NULL if none.
+    @param  tx     Tile left edge on the screen.
+    @param  ty     Tile top edge on the screen.
+*/
+void GFXtiles::drawCommand(const uint8_t *p, const uint8_t *style, int16_t tx,
+                           int16_t ty) {
+  int16_t x = get16(&p[1]) - tx, y = get16(&p[3]) - ty;
+  switch (p[0]) {
+  case TILE_RECT:
+    fillRect(x, y, get16(&p[5]), get16(&p[7]), get16(&p[9]));
+    break;
+  case TILE_LINE:
+    writeLine(x, y, get16(&p[5]) - tx, get16(&p[7]) - ty, get16(&p[9]));
+    break;
+  case TILE_ROUND:
+    Adafruit_GFX::drawRoundRect(x, y, get16(&p[5]), get16(&p[7]),
+                                get16(&p[9]), get16(&p[11]));
+    break;
+  case TILE_FILL_ROUND:
+    Adafruit_GFX::fillRoundRect(x, y, get16(&p[5]), get16(&p[7]),
+                                get16(&p[9]), get16(&p[11]));
+    break;
+  case TILE_PIXEL:
+    drawPixel(x, y, get16(&p[5]));
+    break;
+  case TILE_TEXT: {
+    const GFXfont *saveFont = gfxFont;
+    uint8_t n = charBytes(gfxFont = (GFXfont *)styleFontOf(style));
+    const uint8_t *ch = &p[TILE_TEXT_HEADER];
+    for (uint8_t i = p[13]; i--; ch += n) {
+      uint16_t c = (n > 1) ? (ch[0] | (ch[1] << 8)) : ch[0];
+      Adafruit_GFX::drawChar(x, y, c, get16(&style[1]), get16(&style[3]),
+                             style[5], style[6]);
+      x += advance(c, style[5]);
+    }
+    gfxFont = (GFXfont *)saveFont;
+    break;
+  }
+  case TILE_RGB: {
+    const uint16_t *bitmap = (const uint16_t *)getPtr(&p[9]);
+    int16_t w = get16(&p[5]), h = get16(&p[7]);
+    int16_t i0 = max(0, -x), i1 = min(w, (int16_t)(_width - x));
+    int16_t j = max(0, -y), j1 = min(h, (int16_t)(_height - y));
+    for (; j < j1; j++) {
+      uint16_t *d = &tile[(y + j) * _width + x];
+      for (int16_t i = i0; i < i1; i++)
+        d[i] = pgm_read_word(&bitmap[j * w + i]);
+    }
+    break;
+  }
+  default: { // TILE_BITMAP, TILE_BITMAP_BG
+    bool opaque = (p[0] == TILE_BITMAP_BG);
+    const uint8_t *bitmap = (const uint8_t *)getPtr(&p[opaque ? 13 : 11]);
+    int16_t w = get16(&p[5]), h = get16(&p[7]), byteWidth = (w + 7) / 8;
+    uint16_t color = get16(&p[9]), bg = get16(&p[11]);
+    int16_t i0 = max(0, -x), i1 = min(w, (int16_t)(_width - x));
+    int16_t j = max(0, -y), j1 = min(h, (int16_t)(_height - y));
+    for (; j < j1; j++) {
+      uint16_t *d = &tile[(y + j) * _width + x];
+      for (int16_t i = i0; i < i1; i++) {
+        if (pgm_read_byte(&bitmap[j * byteWidth + i / 8]) & (0x80 >> (i & 7)))
+          d[i] = color;
+        else if (opaque)
+          d[i] = bg;
+      }
+    }
+    break;
+  }
+  }
+}
+
+/*!
+    @brief  Walk the display list for one tile, hashing the commands that
+            touch it and optionally rendering them into the tile buffer.
+    @param  tx    Tile left edge on the screen.
+    @param  ty    Tile top edge on the screen.
+    @param  draw  If set, render; _width and _height must be the tile's.
+    @returns      Hash of the background color and the commands touching
+                  the tile, with their text styles.
+*/
+uint32_t GFXtiles::replay(int16_t tx, int16_t ty, bool draw) {
+  int16_t tx1 = tx + (draw ? _width : tileW) - 1,
+          ty1 = ty + (draw ? _height : tileH) - 1;
+  uint32_t hash = 2166136261UL ^ bgColor;
+  const uint8_t *style = NULL;
+  for (const uint8_t *p = list, *end = &list[listLen]; p < end;) {
+    uint16_t len = commandLength(p, style);
+    int16_t x0 = get16(&p[1]), y0 = get16(&p[3]), x1, y1;
+    switch (p[0]) {
+    case TILE_STYLE:
+      style = p;
+      p += len;
+      continue;
+    case TILE_LINE:
+      x1 = max(x0, get16(&p[5]));
+      y1 = max(y0, get16(&p[7]));
+      x0 = min(x0, get16(&p[5]));
+      y0 = min(y0, get16(&p[7]));
+      break;
+    case TILE_PIXEL:
+      x1 = x0;
+      y1 = y0;
+      break;
+    case TILE_TEXT:
+      x0 = get16(&p[5]);
+      y0 = get16(&p[7]);
+      x1 = get16(&p[9]);
+      y1 = get16(&p[11]);
+      break;
+    default: // Rectangles and bitmaps
+      x1 = x0 + get16(&p[5]) - 1;
+      y1 = y0 + get16(&p[7]) - 1;
+    }
+    if ((x1 >= tx) && (y1 >= ty) && (x0 <= tx1) && (y0 <= ty1)) {
+      if (p[0] == TILE_TEXT) // The text's style is part of it
+        hash = hashBytes(hash, style, 7 + TILE_PTR);
+      hash = hashBytes(hash, p, len);
+      if (draw)
+        drawCommand(p, style, tx, ty);
+    }
+    p += len;
+  }
+  return hash;
+}
+
+/*!
+    @brief  Send the tiles whose hash changed, a band of rows at a time.
+    @param  all  Send every tile regardless.
+    @returns     Number of tiles sent.
+*/
+uint16_t GFXtiles::sendTiles(bool all) {
+  uint16_t sent = 0;
+  uint32_t *hash = hashes;
+  int16_t screenW = _width, screenH = _height;
+
+  tft->startWrite();
+  for (int16_t ty = 0; ty < screenH; ty += tileH) {
+    for (int16_t tx = 0; tx < screenW; tx += tileW, hash++) {
+      uint32_t sum = replay(tx, ty, false);
+      if (!all && (sum == *hash))
+        continue;
+      *hash = sum;
+      int16_t w = min((int16_t)tileW, (int16_t)(screenW - tx)),
+              h = min((int16_t)tileH, (int16_t)(screenH - ty));
+      for (int16_t by = 0; by < h; by += bandH) {
+        _width = w;
+        _height = min((int16_t)bandH, (int16_t)(h - by));
+        uint16_t n = _width * _height;
+        for (uint16_t i = 0; i < n; i++)
+          tile[i] = bgColor;
+        drawing = true;
+        replay(tx, ty + by, true);
+        drawing = false;
+        tft->setAddrWindow(tx, ty + by, _width, _height);
+        tft->writePixels(tile, n);
+      }
+      _width = screenW;
+      _height = screenH;
+      sent++;
+    }
+  }
+  tft->endWrite();
+  return sent;
+}
+
+/*!
+    @brief  Send the tiles whose drawing changed since the last frame, then
+            start a new frame. The next frame's drawing starts from an
+            empty list with the same fillScreen() color; call fillScreen()
+            first to change it.
+    @returns  Number of tiles sent, or 0 if this frame overflowed the list:
+              its tiles were all sent then, and the next frame sends them
+              all again.
+*/
+uint16_t GFXtiles::display(void) {
+  uint16_t sent = 0;
+  if (direct) { // Hashes don't cover what was drawn straight to the panel
+    direct = false;
+    dirty = true;
+  } else if (tile && hashes) {
+    sent = sendTiles(dirty);
+    dirty = false;
+  }
+
+  listLen = 0;
+  run = NULL;
+  styled = false;
+  return sent;
+}
+
+#endif // end __AVR_ATtiny85__
@@ -0,0 +1,114 @@
+/*!
+ * @file Adafruit_SPITFT_Tiles.h
+ *
+ * Part of Adafruit's GFX graphics library. A display list for
+ * Adafruit_SPITFT panels, for MCUs without the RAM for a framebuffer:
+ * drawing is recorded rather than sent, and display() then renders the
+ * screen one small tile at a time, sending only the tiles whose drawing
+ * changed since the last frame.
+ *
+ * BSD license, all text here must be included in any redistribution.
+ */
+
+#ifndef _ADAFRUIT_SPITFT_TILES_H_
+#define _ADAFRUIT_SPITFT_TILES_H_
+
+#if !defined(__AVR_ATtiny85__) // Not for ATtiny, at all
+
+#include "Adafruit_SPITFT.h"
+
+#ifndef SPITFT_TILE_SIZE
+#define SPITFT_TILE_SIZE 32 ///< Default tile width and height in pixels
+#endif
+
+#ifndef SPITFT_TILE_ROWS
+#if defined(__AVR__)
+#define SPITFT_TILE_ROWS 4 ///< Default tile rows rendered at a time
+#else
+#define SPITFT_TILE_ROWS SPITFT_TILE_SIZE ///< Default tile rows at a time
+#endif
+#endif
+
+/// Records drawing for an Adafruit_SPITFT panel into a display list, and
+/// on display() replays the list into each tile of the screen in turn and
+/// sends the tile with one address window. Draw the whole screen every
+/// frame, starting with fillScreen(): a tile is only sent when the
+/// commands touching it differ from last frame's, so nothing flickers and
+/// unchanged areas cost no SPI time. Rectangles, lines, circles, rounded
+/// rectangles, text and PROGMEM bitmaps take one command each; other
+/// shapes are recorded pixel by pixel, so keep them small. Adafruit_GFX
+/// doesn't make circles, rounded rectangles or bitmaps virtual, so draw
+/// those through the GFXtiles itself rather than an Adafruit_GFX pointer
+/// or reference, or they are recorded in pieces too. A frame that overflows the list still
+/// comes out right, but flickers: the tiles recorded so far are all sent
+/// and the rest of the frame is drawn straight to the panel. RAM is the
+/// list, 2 bytes per pixel of the rows rendered at a time and 4 bytes per
+/// tile of the screen; with the AVR defaults on a 320x240 panel that is
+/// 256 + 256 + 320 = 832 bytes.
+class GFXtiles : public Adafruit_GFX {
+public:
+  GFXtiles(Adafruit_SPITFT *tft, uint16_t listBytes = 256,
+           uint8_t tileW = SPITFT_TILE_SIZE, uint8_t tileH = SPITFT_TILE_SIZE,
+           uint8_t bandH = SPITFT_TILE_ROWS);
+  ~GFXtiles(void);
+  void drawPixel(int16_t x, int16_t y, uint16_t color),
+      fillScreen(uint16_t color),
+      drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+      drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+      fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
+      writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                uint16_t color);
+  using Adafruit_GFX::drawChar;
+  void drawChar(int16_t x, int16_t y, uint16_t c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y);
+  using Adafruit_GFX::drawBitmap;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color),
+      drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                 int16_t h, uint16_t color, uint16_t bg);
+  using Adafruit_GFX::drawRGBBitmap;
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                     int16_t w, int16_t h);
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
+      fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
+      drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                    uint16_t color),
+      fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                    uint16_t color);
+  uint16_t display(void);
+
+private:
+  uint8_t *record(uint8_t op, uint16_t bytes);
+  void spill(void);
+  uint16_t sendTiles(bool all);
+  uint32_t replay(int16_t tx, int16_t ty, bool draw);
+  void drawCommand(const uint8_t *p, const uint8_t *style, int16_t tx,
+                   int16_t ty);
+  int16_t advance(uint16_t c, uint8_t size_x) const;
+  void roundRect(uint8_t op, int16_t x, int16_t y, int16_t w, int16_t h,
+                 int16_t r, uint16_t color);
+  Adafruit_SPITFT *tft; ///< Panel display() sends tiles to
+  uint8_t *list;        ///< Display list
+  uint8_t *run;         ///< Text command still taking characters, or NULL
+  uint16_t *tile;       ///< Pixels of the tile rows being rendered
+  uint32_t *hashes;     ///< Last frame's command hash of each tile
+  uint16_t listSize,    ///< Bytes allocated for list
+      listLen,          ///< Bytes of list in use
+      bgColor;          ///< fillScreen() color tiles start from
+  int16_t runNextX;     ///< Where the next character continues the run
+  uint16_t styleColor,  ///< Text color of the last style command
+      styleBg;          ///< Text background of the last style command
+  const GFXfont *styleFont; ///< Font of the last style command
+  uint8_t styleX,       ///< Text magnification in X of the last style
+      styleY,           ///< Text magnification in Y of the last style
+      tileW,            ///< Tile width in pixels
+      tileH,            ///< Tile height in pixels
+      bandH;            ///< Tile rows rendered and sent at a time
+  bool styled,          ///< Set once this frame has a style command
+      drawing,          ///< Set while rendering a tile rather than recording
+      dirty,            ///< Send every tile at the next display()
+      direct;           ///< Set once this frame overflowed the list
+};
+
+#endif // end __AVR_ATtiny85__
+#endif // end _ADAFRUIT_SPITFT_TILES_H_
@@ -8,11 +8,34 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+With -z, glyph bitmaps are packed as row deltas (see GFX_FONT_PACKED in
+gfxfont.h), typically 35-40% of the plain size at 18pt and up.  Small
+fonts gain little or even grow; where packing would not save space the
+plain format is written instead, with a note on stderr.
+
+With -p, glyph bitmaps are stored as the SSD1306 stores its framebuffer
+(see GFX_FONT_PAGES in gfxfont.h), so that display can copy glyph column
+bytes straight in rather than setting pixels one at a time.
+
+With -a 2 or -a 4, glyphs are anti-aliased: FreeType's gray rendering is
+kept as 2 or 4 bits of coverage per pixel (see GFX_FONT_AA2 in gfxfont.h)
+for color displays and canvases, at 2 or 4 times the plain size.
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
-Currently this only extracts the printable 7-bit ASCII chars of a font.
-Will eventually extend with some int'l chars a la ftGFX, not there yet.
-Keep 7-bit fonts around as an option in that case, more compact.
+By default this extracts the printable 7-bit ASCII chars of a font.
+With -u, text and -c/-f characters are UTF-8 and any characters up to
+U+FFFF can be added, e.g. units and symbols (see GFX_FONT_UTF8 in
+gfxfont.h):
+  ./fontconvert -u -c "°µ±↑↓" FreeSans.ttf 12
+
+A subset of those (-c, -f) can be extracted instead, e.g. only the
+characters a UI prints, with a sparse glyph table (see GFXrange in
+gfxfont.h).  Several sizes can be converted at once, one header each:
+  ./fontconvert -z -f ../../../src/UI.cpp FreeSans.ttf 9,12,18,24
+
+Adafruit_GFX handles -z, -p, -a and -u fonts only when built with the
+GFX_ENABLE_* flag for them listed in Adafruit_GFX.h.
 
 See notes at end for glyph nomenclature & other tidbits.
 */
@@ -22,15 +45,24 @@ See notes at end for glyph nomenclature & other tidbits.
 #include <ft2build.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include FT_GLYPH_H
 #include FT_TRUETYPE_DRIVER_H
 #include "../gfxfont.h" // Adafruit_GFX font structures
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
+// Set while sizing glyphs that are left out, to write nothing
+int counting = 0;
+
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
   static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+  if (counting)
+    return;
   if (value)
     sum |= bit;          // Set bit if needed
   if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
@@ -49,71 +81,220 @@ void enbit(uint8_t value) {
   }
 }
 
-int main(int argc, char *argv[]) {
-  int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
-  char *fontName, c, *ptr;
-  FT_Library library;
-  FT_Face face;
-  FT_Glyph glyph;
-  FT_Bitmap *bitmap;
-  FT_BitmapGlyphRec *g;
-  GFXglyph *table;
-  uint8_t bit;
+// Write the low n bits of value, MSB first
+void enbits(uint32_t value, int n) {
+  while (n--)
+    enbit((value >> n) & 1);
+}
 
-  // Parse command line.  Valid syntaxes are:
-  //   fontconvert [filename] [size]
-  //   fontconvert [filename] [size] [last char]
-  //   fontconvert [filename] [size] [first char] [last char]
-  // Unless overridden, default first and last chars are
-  // ' ' (space) and '~', respectively
+// Write an order-2 exp-Golomb number, returns bits written
+int engap(int value) {
+  int len = 0;
+  for (uint32_t v = value + 4; v; v >>= 1)
+    len++;
+  enbits(0, len - 3);
+  enbits(value + 4, len);
+  return 2 * len - 3;
+}
 
-  if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
-    return 1;
+// Write a glyph as GFX_FONT_PAGES column bytes, pad blank rows above it,
+// returns bits written
+int enpages(FT_Bitmap *bitmap, int pad) {
+  int bands = (pad + bitmap->rows + 7) / 8, band, x, k;
+
+  for (band = 0; band < bands; band++) {
+    for (x = 0; x < (int)bitmap->width; x++) {
+      uint8_t col = 0;
+      for (k = 0; k < 8; k++) {
+        int y = band * 8 + k - pad;
+        if ((y >= 0) && (y < (int)bitmap->rows) &&
+            (bitmap->buffer[y * bitmap->pitch + x / 8] & (0x80 >> (x & 7))))
+          col |= 1 << k;
+      }
+      enbits(col, 8);
+    }
   }
+  return bands * bitmap->width * 8;
+}
 
-  size = atoi(argv[2]);
+// Write a gray glyph as GFX_FONT_AA2 or GFX_FONT_AA4 coverage, rounded to
+// bpp bits, returns bits written
+int enaa(FT_Bitmap *bitmap, int bpp) {
+  int levels = (1 << bpp) - 1, x, y;
 
-  if (argc == 4) {
-    last = atoi(argv[3]);
-  } else if (argc == 5) {
-    first = atoi(argv[3]);
-    last = atoi(argv[4]);
+  for (y = 0; y < (int)bitmap->rows; y++) {
+    for (x = 0; x < (int)bitmap->width; x++)
+      enbits((bitmap->buffer[y * bitmap->pitch + x] * levels + 127) / 255,
+             bpp);
   }
+  return bitmap->width * bitmap->rows * bpp;
+}
 
-  if (last < first) {
-    i = first;
-    first = last;
-    last = i;
+// Write a glyph as GFX_FONT_PACKED row deltas, returns bits written
+int enpacked(FT_Bitmap *bitmap) {
+  int prev[GFX_FONT_PACKED_MAX_CHANGES], cur[GFX_FONT_PACKED_MAX_CHANGES];
+  int np = 0, nc, x, y, i, n = 0;
+
+  for (y = 0; y < bitmap->rows; y++) {
+    uint8_t *row = &bitmap->buffer[y * bitmap->pitch], set = 0, px;
+    for (x = 0, nc = 0; x <= (int)bitmap->width; x++) {
+      px = (x < (int)bitmap->width) ? (row[x / 8] >> (7 - (x & 7))) & 1 : 0;
+      if (px != set) {
+        if (nc == GFX_FONT_PACKED_MAX_CHANGES) {
+          fprintf(stderr, "Glyph row too complex to pack\n");
+          exit(1);
+        }
+        cur[nc++] = x;
+        set = px;
+      }
+    }
+    for (i = 0; (nc == np) && (i < nc); i++) {
+      if (abs(cur[i] - prev[i]) > 2)
+        break;
+    }
+    if ((nc == np) && (i == nc)) { // Changes moved by at most 2 pixels
+      enbit(0);
+      n++;
+      for (i = 0; i < nc; i++) {
+        int d = cur[i] - prev[i];
+        if (d) {
+          enbit(1);
+          enbit(abs(d) == 2);
+          enbit(d < 0);
+          n += 3;
+        } else {
+          enbit(0);
+          n++;
+        }
+      }
+    } else {
+      enbit(1);
+      enbits(nc / 2, 4);
+      n += 5;
+      for (i = 0, x = 0; i < nc; x = cur[i++])
+        n += engap(cur[i] - x);
+    }
+    memcpy(prev, cur, sizeof(cur));
+    np = nc;
   }
+  return n;
+}
 
-  ptr = strrchr(argv[1], '/'); // Find last slash in filename
-  if (ptr)
-    ptr++; // First character of filename (path stripped)
-  else
-    ptr = argv[1]; // No path; font in local dir.
-
-  // Allocate space for font name and glyph table
-  if ((!(fontName = malloc(strlen(ptr) + 20))) ||
-      (!(table = (GFXglyph *)malloc((last - first + 1) * sizeof(GFXglyph))))) {
-    fprintf(stderr, "Malloc error\n");
-    return 1;
+// Bytes of the wanted glyphs' bitmaps, first to last, packed (returned)
+// and plain (in *plain), to check that packing pays before writing a font
+int packedSize(FT_Face face, int first, int last, const uint8_t *want,
+               int *plain) {
+  int i, packed = 0;
+
+  *plain = 0;
+  counting = 1;
+  for (i = first; i <= last; i++) {
+    if (!want[i] || FT_Load_Char(face, i, FT_LOAD_TARGET_MONO) ||
+        FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO))
+      continue; // Errors are reported when the glyph is written
+    FT_Bitmap *bitmap = &face->glyph->bitmap;
+    packed += (enpacked(bitmap) + 7) / 8;
+    *plain += (bitmap->width * bitmap->rows + 7) / 8;
   }
+  counting = 0;
+  return packed;
+}
+
+// Derive font table names from filename.  Period (filename
+// extension) is truncated and replaced with the font size & bits.
+// Returns a malloc'd string, or NULL on failure.
+char *fontNameFor(const char *file, int size, int last) {
+  const char *base = strrchr(file, '/'); // Find last slash in filename
+  char *fontName, *ptr, c;
+  int i;
 
-  // Derive font table names from filename.  Period (filename
-  // extension) is truncated and replaced with the font size & bits.
-  strcpy(fontName, ptr);
+  if (base)
+    base++; // First character of filename (path stripped)
+  else
+    base = file; // No path; font in local dir.
+
+  if (!(fontName = malloc(strlen(base) + 20)))
+    return NULL;
+  strcpy(fontName, base);
   ptr = strrchr(fontName, '.'); // Find last period (file ext)
   if (!ptr)
     ptr = &fontName[strlen(fontName)]; // If none, append
   // Insert font size and 7/8 bit.  fontName was alloc'd w/extra
   // space to allow this, we're not sprintfing into Forbidden Zone.
-  sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+  sprintf(ptr, "%dpt%db", size, (last > 255) ? 16 : (last > 127) ? 8 : 7);
   // Space and punctuation chars in name replaced w/ underscores.
   for (i = 0; (c = fontName[i]); i++) {
     if (isspace(c) || ispunct(c))
       fontName[i] = '_';
   }
+  return fontName;
+}
+
+// Mark the characters in n bytes of text as wanted, decoding UTF-8 if utf8
+// is set.  Characters past U+FFFF and malformed sequences are left out.
+void wantText(uint8_t *want, const uint8_t *text, size_t n, int utf8) {
+  size_t i = 0;
+
+  while (i < n) {
+    int c = text[i++], more = 0;
+    if (utf8 && (c >= 0x80)) {
+      if (c < 0xC0)
+        continue; // Stray continuation byte
+      more = (c >= 0xF0) ? 3 : (c >= 0xE0) ? 2 : 1;
+      c &= 0x3F >> more;
+      for (; more && (i < n) && ((text[i] & 0xC0) == 0x80); more--)
+        c = (c << 6) | (text[i++] & 0x3F);
+    }
+    if (!more && (c <= 0xFFFF))
+      want[c] = 1;
+  }
+}
+
+// Convert one size of a font to a GFXfont on stdout.  Characters first
+// to last for which want[] is set are included; if that leaves gaps, the
+// glyph table is sparse and a GFXrange index is emitted with it.  UTF-8
+// fonts always have the index, their characters can be past 0xFF.
+int convert(const char *file, int size, int first, int last, uint8_t flags,
+            const uint8_t *want) {
+  int i, j, err, bitmapOffset = 0, fullBytes = 0, x, y, byte, nGlyphs = 0,
+                 nRanges = 0, total;
+  char *fontName;
+  FT_Library library;
+  FT_Face face;
+  FT_Glyph glyph;
+  FT_Bitmap *bitmap;
+  FT_BitmapGlyphRec *g;
+  GFXglyph *table;
+  uint8_t bit;
+  int aa = (flags & GFX_FONT_AA4) ? 4 : (flags & GFX_FONT_AA2) ? 2 : 0;
+
+  for (i = first; i <= last; i++) {
+    if (want[i]) {
+      if (!nGlyphs++ || !want[i - 1])
+        nRanges++;
+    }
+  }
+  if (!nGlyphs) {
+    fprintf(stderr, "No characters to convert\n");
+    return 1;
+  }
+  if (nRanges > 255) {
+    fprintf(stderr, "Too many runs of characters\n");
+    return 1;
+  }
+  int sparse = (nRanges > 1) || (flags & GFX_FONT_UTF8);
+  int fullFirst = first, fullLast = last; // Range without subsetting
+  while (!want[first]) // Trim the range to the characters wanted
+    first++;
+  while (!want[last])
+    last--;
+
+  // Allocate space for font name and glyph table
+  if ((!(fontName = fontNameFor(file, size, last))) ||
+      (!(table = (GFXglyph *)malloc((last - first + 1) * sizeof(GFXglyph))))) {
+    fprintf(stderr, "Malloc error\n");
+    return 1;
+  }
 
   // Init FreeType lib, load font
   if ((err = FT_Init_FreeType(&library))) {
@@ -122,14 +303,15 @@ int main(int argc, char *argv[]) {
   }
 
   // Use TrueType engine version 35, without subpixel rendering.
-  // This improves clarity of fonts since this library does not
-  // support rendering multiple levels of gray in a glyph.
+  // This improves clarity of 1-bit fonts, whose glyphs have no levels
+  // of gray to soften the hinting; -a fonts keep 2 or 4 bits of gray
+  // coverage, but with no color fringes to draw, still no subpixels.
   // See https://github.com/adafruit/Adafruit-GFX-Library/issues/103
   FT_UInt interpreter_version = TT_INTERPRETER_VERSION_35;
   FT_Property_Set(library, "truetype", "interpreter-version",
                   &interpreter_version);
 
-  if ((err = FT_New_Face(library, argv[1], 0, &face))) {
+  if ((err = FT_New_Face(library, file, 0, &face))) {
     fprintf(stderr, "Font load error: %d", err);
     FT_Done_FreeType(library);
     return err;
@@ -138,6 +320,17 @@ int main(int argc, char *argv[]) {
   // << 6 because '26dot6' fixed-point format
   FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
 
+  if (flags & GFX_FONT_PACKED) {
+    int plain, packed = packedSize(face, first, last, want, &plain);
+    if (packed >= plain) {
+      fprintf(stderr,
+              "%s: packed bitmaps would be %d bytes, plain %d; "
+              "writing plain\n",
+              fontName, packed, plain);
+      flags &= ~GFX_FONT_PACKED;
+    }
+  }
+
   // Currently all symbols from 'first' to 'last' are processed.
   // Fonts may contain WAY more glyphs than that, but this code
   // will need to handle encoding stuff to deal with extracting
@@ -146,28 +339,55 @@ int main(int argc, char *argv[]) {
 
   printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
 
-  // Process glyphs and output huge bitmap data array
-  for (i = first, j = 0; i <= last; i++, j++) {
+  // Process glyphs and output huge bitmap data array.  Glyphs left
+  // out of a subset are still rendered, to report what they would
+  // have cost.
+  for (i = fullFirst; i <= fullLast; i++) {
+    j = i - first;
+    if (!want[i] && (i > 0xFF))
+      continue; // Only the 8-bit range is sized for the report
+
+    if (want[i] && !FT_Get_Char_Index(face, i))
+      fprintf(stderr, "%s: no glyph for U+%04X\n", file, i);
+
     // MONO renderer provides clean image with perfect crop
-    // (no wasted pixels) via bitmap struct.
-    if ((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
-      fprintf(stderr, "Error %d loading char '%c'\n", err, i);
+    // (no wasted pixels) via bitmap struct.  Anti-aliased fonts
+    // use the 8-bit gray renderer instead.
+    if ((err = FT_Load_Char(face, i, aa ? FT_LOAD_TARGET_NORMAL
+                                        : FT_LOAD_TARGET_MONO))) {
+      fprintf(stderr, "Error %d loading char U+%04X\n", err, i);
       continue;
     }
 
-    if ((err = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO))) {
-      fprintf(stderr, "Error %d rendering char '%c'\n", err, i);
+    if ((err = FT_Render_Glyph(face->glyph, aa ? FT_RENDER_MODE_NORMAL
+                                               : FT_RENDER_MODE_MONO))) {
+      fprintf(stderr, "Error %d rendering char U+%04X\n", err, i);
       continue;
     }
 
     if ((err = FT_Get_Glyph(face->glyph, &glyph))) {
-      fprintf(stderr, "Error %d getting glyph '%c'\n", err, i);
+      fprintf(stderr, "Error %d getting glyph U+%04X\n", err, i);
       continue;
     }
 
     bitmap = &face->glyph->bitmap;
     g = (FT_BitmapGlyphRec *)glyph;
 
+    if (!want[i]) { // Size it only
+      int bits = bitmap->width * bitmap->rows;
+      counting = 1;
+      if (flags & GFX_FONT_PACKED)
+        bits = enpacked(bitmap);
+      else if (flags & GFX_FONT_PAGES)
+        bits = enpages(bitmap, (1 - g->top) & 7);
+      else if (aa)
+        bits = enaa(bitmap, aa);
+      counting = 0;
+      fullBytes += (bits + 7) / 8 + 7;
+      FT_Done_Glyph(glyph);
+      continue;
+    }
+
     // Minimal font and per-glyph information is stored to
     // reduce flash space requirements.  Glyph bitmaps are
     // fully bit-packed; no per-scanline pad, though end of
@@ -183,22 +403,32 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
-    for (y = 0; y < bitmap->rows; y++) {
-      for (x = 0; x < bitmap->width; x++) {
-        byte = x / 8;
-        bit = 0x80 >> (x & 7);
-        enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+    int bits = bitmap->width * bitmap->rows;
+    if (flags & GFX_FONT_PACKED) {
+      bits = enpacked(bitmap);
+    } else if (flags & GFX_FONT_PAGES) {
+      bits = enpages(bitmap, table[j].yOffset & 7);
+    } else if (aa) {
+      bits = enaa(bitmap, aa);
+    } else {
+      for (y = 0; y < bitmap->rows; y++) {
+        for (x = 0; x < bitmap->width; x++) {
+          byte = x / 8;
+          bit = 0x80 >> (x & 7);
+          enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+        }
       }
     }
 
     // Pad end of char bitmap to next byte boundary if needed
-    int n = (bitmap->width * bitmap->rows) & 7;
-    if (n) {     // Pixel count not an even multiple of 8?
+    int n = bits & 7;
+    if (n) {     // Bit count not an even multiple of 8?
       n = 8 - n; // # bits to next multiple
       while (n--)
         enbit(0);
     }
-    bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+    bitmapOffset += (bits + 7) / 8;
+    fullBytes += (bits + 7) / 8 + 7;
 
     FT_Done_Glyph(glyph);
   }
@@ -208,6 +438,8 @@ int main(int argc, char *argv[]) {
   // Output glyph attributes table (one per character)
   printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
   for (i = first, j = 0; i <= last; i++, j++) {
+    if (!want[i])
+      continue;
     printf("  { %5d, %3d, %3d, %3d, %4d, %4d }", table[j].bitmapOffset,
            table[j].width, table[j].height, table[j].xAdvance, table[j].xOffset,
            table[j].yOffset);
@@ -224,26 +456,261 @@ int main(int argc, char *argv[]) {
     printf(" '%c'", last);
   printf("\n\n");
 
+  // Output the index of a sparse glyph table, one entry per run of
+  // consecutive characters
+  if (sparse) {
+    printf("const GFXrange %sRanges[] PROGMEM = {\n", fontName);
+    for (i = first, j = 0; i <= last; i++) {
+      if (want[i] && ((i == first) || !want[i - 1])) {
+        int end = i;
+        while (want[end + 1] && (end < last))
+          end++;
+        printf("  { 0x%04X, 0x%04X, %3d }%s\n", i, end, j,
+               (end < last) ? "," : " };");
+        j += end - i + 1;
+        i = end;
+      }
+    }
+    printf("\n");
+  }
+
   // Output font structure
   printf("const GFXfont %s PROGMEM = {\n", fontName);
   printf("  (uint8_t  *)%sBitmaps,\n", fontName);
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
+  // The 8-bit first and last only describe the index of a UTF-8 font
+  if (first > 0xFF)
+    first = 0xFF;
+  if (last > 0xFF)
+    last = 0xFF;
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("  0x%02X, 0x%02X, %d", first, last, table[0].height);
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
+    printf("  0x%02X, 0x%02X, %ld", first, last,
            face->size->metrics.height >> 6);
   }
-  printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
+  const char *format = (flags & GFX_FONT_PACKED)  ? "GFX_FONT_PACKED"
+                       : (flags & GFX_FONT_PAGES) ? "GFX_FONT_PAGES"
+                       : (flags & GFX_FONT_AA2)   ? "GFX_FONT_AA2"
+                       : (flags & GFX_FONT_AA4)   ? "GFX_FONT_AA4"
+                                                  : NULL;
+  char flagName[48];
+  if (flags & GFX_FONT_UTF8)
+    snprintf(flagName, sizeof(flagName), "%s%sGFX_FONT_UTF8",
+             format ? format : "", format ? " | " : "");
+  else
+    snprintf(flagName, sizeof(flagName), "%s", format ? format : "0");
+  if (sparse) {
+    printf(", %s,\n  (GFXrange *)%sRanges, %d };\n\n", flagName, fontName,
+           nRanges);
+  } else if (flags) {
+    printf(", %s };\n\n", flagName);
+  } else {
+    printf(" };\n\n");
+  }
   // Size estimate is based on AVR struct and pointer sizes;
   // actual size may vary.
+  total = bitmapOffset + nGlyphs * 7 + 11 + (sparse ? nRanges * 6 : 0);
+  printf("// Approx. %d bytes\n", total);
+  fprintf(stderr, "%s: approx. %d bytes for %d chars", fontName, total,
+          nGlyphs);
+  if (fullBytes + 11 > total)
+    fprintf(stderr, ", saves %d of %d for 0x%02X-0x%02X",
+            fullBytes + 11 - total, fullBytes + 11, fullFirst, fullLast);
+  fprintf(stderr, "\n");
 
   FT_Done_FreeType(library);
 
   return 0;
 }
 
+int main(int argc, char *argv[]) {
+  int i, first = ' ', last = -1, nSizes = 0, sizes[16], subset = 0, nText = 0;
+  const char *prog = argv[0], *outDir = NULL, *text[16];
+  static uint8_t want[0x10001];
+  uint8_t flags = 0, isFile[16];
+  char *ptr;
+  FILE *fp;
+
+  // Parse command line.  Valid syntaxes are:
+  //   fontconvert [options] [filename] [size]
+  //   fontconvert [options] [filename] [size] [last char]
+  //   fontconvert [options] [filename] [size] [first char] [last char]
+  // Unless overridden, default first and last chars are
+  // ' ' (space) and '~', respectively.  Options:
+  //   -z           Pack glyph bitmaps (GFX_FONT_PACKED)
+  //   -p           SSD1306 page-major glyph bitmaps (GFX_FONT_PAGES)
+  //   -a 2|4       Anti-aliased 2 or 4 bit coverage (GFX_FONT_AA2/AA4)
+  //   -u           UTF-8 text and characters up to U+FFFF (GFX_FONT_UTF8)
+  //   -c chars     Only include these characters
+  //   -f file      Only include characters used in this file,
+  //                e.g. the UI source; may be combined with -c
+  // With -u and -c or -f, last defaults to 0xFFFF so that the symbols
+  // named are kept.
+  //   -o dir       Directory for the headers of a multi-size batch
+  // size may be a comma-separated list, e.g. 9,12,18,24; each size is
+  // then written to its own header, named as the font table, and the
+  // sizes are converted in parallel.
+
+  while ((i = getopt(argc, argv, "zpa:uc:f:o:")) != -1) {
+    switch (i) {
+    case 'z':
+      flags |= GFX_FONT_PACKED;
+      break;
+    case 'p':
+      flags |= GFX_FONT_PAGES;
+      break;
+    case 'a':
+      if (atoi(optarg) == 2)
+        flags |= GFX_FONT_AA2;
+      else if (atoi(optarg) == 4)
+        flags |= GFX_FONT_AA4;
+      else
+        argc = 0; // Print usage
+      break;
+    case 'u':
+      flags |= GFX_FONT_UTF8;
+      break;
+    case 'c': // Decoded once -u is known
+    case 'f':
+      if (nText < 16) {
+        isFile[nText] = (i == 'f');
+        text[nText++] = optarg;
+      }
+      subset = 1;
+      break;
+    case 'o':
+      outDir = optarg;
+      break;
+    default:
+      argc = 0; // Print usage
+      break;
+    }
+  }
+  argc -= optind - 1; // Leave argv[1] as the font file
+  argv += optind - 1;
+
+  // One bitmap format at a time
+  uint8_t format = flags & ~GFX_FONT_UTF8;
+  if ((argc < 3) || (format & (format - 1))) {
+    fprintf(stderr,
+            "Usage: %s [-z|-p|-a 2|4] [-u] [-c chars] [-f file] [-o dir] fontfile "
+            "size[,size...] [first] [last]\n",
+            prog);
+    return 1;
+  }
+
+  for (ptr = argv[2]; *ptr && (nSizes < 16); ptr++) {
+    sizes[nSizes++] = strtol(ptr, &ptr, 10);
+    if (*ptr != ',')
+      break;
+  }
+
+  for (i = 0; i < nText; i++) {
+    uint8_t *buf = (uint8_t *)text[i];
+    long n = strlen(text[i]);
+    if (isFile[i]) {
+      if (!(fp = fopen(text[i], "rb"))) {
+        fprintf(stderr, "Can't open %s\n", text[i]);
+        return 1;
+      }
+      fseek(fp, 0, SEEK_END);
+      n = ftell(fp);
+      rewind(fp);
+      if (!(buf = malloc(n + 1)) || (fread(buf, 1, n, fp) != (size_t)n)) {
+        fprintf(stderr, "Can't read %s\n", text[i]);
+        return 1;
+      }
+      fclose(fp);
+    }
+    wantText(want, buf, n, flags & GFX_FONT_UTF8);
+    if (isFile[i])
+      free(buf);
+  }
+
+  if (argc == 4) {
+    last = atoi(argv[3]);
+  } else if (argc == 5) {
+    first = atoi(argv[3]);
+    last = atoi(argv[4]);
+  } else {
+    last = ((flags & GFX_FONT_UTF8) && subset) ? 0xFFFF : '~';
+  }
+
+  if (last < first) {
+    i = first;
+    first = last;
+    last = i;
+  }
+  if ((first < 0) || (last > ((flags & GFX_FONT_UTF8) ? 0xFFFF : 255))) {
+    fprintf(stderr, "Characters must be 0 to %s\n",
+            (flags & GFX_FONT_UTF8) ? "0xFFFF" : "255");
+    return 1;
+  }
+
+  for (i = 0; i <= 0xFFFF; i++) {
+    if ((i < first) || (i > last))
+      want[i] = 0;
+    else if (!subset)
+      want[i] = 1;
+  }
+  int nameLast = last; // Name the font by what it holds, as convert() does
+  while ((nameLast > first) && !want[nameLast])
+    nameLast--;
+
+  if (nSizes == 1)
+    return convert(argv[1], sizes[0], first, last, flags, want);
+
+  // Batch: one child per size, as many at once as there are cores
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  int running = 0, failed = 0, status;
+
+  for (i = 0; (i < nSizes) || running;) {
+    if ((i < nSizes) && (running < cores)) {
+      pid_t pid = fork();
+      if (pid < 0) {
+        perror("fork");
+        return 1;
+      }
+      if (!pid) {
+        // Written beside the header and renamed over it only once whole,
+        // so a failed size leaves neither an empty nor a clobbered header
+        char *name = fontNameFor(argv[1], sizes[i], nameLast), path[1024],
+             tmp[1028];
+        snprintf(path, sizeof(path), "%s%s%s.h", outDir ? outDir : "",
+                 outDir ? "/" : "", name);
+        snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+        if (!freopen(tmp, "w", stdout)) {
+          perror(tmp);
+          _exit(1);
+        }
+        int rc = convert(argv[1], sizes[i], first, last, flags, want);
+        if (fclose(stdout) && !rc) {
+          perror(tmp);
+          rc = 1;
+        }
+        if (!rc && rename(tmp, path)) {
+          perror(path);
+          rc = 1;
+        }
+        if (rc)
+          unlink(tmp);
+        _exit(rc);
+      }
+      running++;
+      i++;
+    } else {
+      wait(&status);
+      running--;
+      if (!WIFEXITED(status) || WEXITSTATUS(status))
+        failed = 1;
+    }
+  }
+
+  return failed;
+}
+
 /* -------------------------------------------------------------------------
 
 Character metrics are slightly different from classic GFX & ftGFX.
@@ -6,7 +6,7 @@
 # bold, oblique or italic, and bold+oblique or bold+italic; and four
 # sizes: 9, 12, 18 and 24 point.  No real error checking or anything,
 # this just powers through all the combinations, calling the fontconvert
-# utility and redirecting the output to a .h file for each combo.
+# utility to write a .h file for each combo.
 
 # Adafruit_GFX repository does not include the source outline fonts
 # (huge zipfile, different license) but they're easily acquired:
@@ -17,22 +17,21 @@ inpath=~/Desktop/freefont/
 outpath=../Fonts/
 fonts=(FreeMono FreeSans FreeSerif)
 styles=("" Bold Italic BoldItalic Oblique BoldOblique)
-sizes=(9 12 18 24)
+sizes=9,12,18,24
+
+# fontconvert converts all sizes of a font at once, one header per size
+# named after the font table (e.g. FreeSans9pt7b.h), in parallel.
 
 for f in ${fonts[*]}
 do
 	for index in ${!styles[*]}
 	do
 		st=${styles[$index]}
-		for si in ${sizes[*]}
-		do
-			infile=$inpath$f$st".ttf"
-			if [ -f $infile ] # Does source combination exist?
-			  then
-				outfile=$outpath$f$st$si"pt7b.h"
-#				printf "%s %s %s > %s\n" $convert $infile $si $outfile
-				$convert $infile $si > $outfile
-			fi
-		done
+		infile=$inpath$f$st".ttf"
+		if [ -f $infile ] # Does source combination exist?
+		  then
+#			printf "%s -o %s %s %s\n" $convert $outpath $infile $sizes
+			$convert -o $outpath $infile $sizes
+		fi
 	done
 done
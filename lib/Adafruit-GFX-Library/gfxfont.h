@@ -7,6 +7,43 @@
 #ifndef _GFXFONT_H_
 #define _GFXFONT_H_
 
+/// GFXfont::flags bit: glyph bitmaps are packed row deltas (fontconvert -z)
+/// rather than plain bits. Each glyph starts on a byte and is a bitstream,
+/// MSB first, of one code per row describing where the row's pixels change
+/// color: '0' then, for each change in the row above, '0' (same place) or
+/// '1', magnitude (0 = 1 pixel, 1 = 2) and sign (1 = left); or '1', the
+/// number of set runs in 4 bits, then the gap before each change as an
+/// order-2 exp-Golomb number. Rows start unset and the row above the first
+/// has no changes. Drawn only when the library is built with
+/// GFX_ENABLE_PACKED_FONTS.
+#define GFX_FONT_PACKED 0x01
+
+/// GFXfont::flags bit: glyph bitmaps are in the SSD1306's page-major layout
+/// (fontconvert -p): (pad + height + 7) / 8 bands of width column bytes, LSB
+/// at top, with pad = yOffset & 7 blank rows above the glyph. The padding
+/// lines bands up with the display's pages whenever the cursor y is a
+/// multiple of 8, so glyph bytes go into the framebuffer unshifted. Drawn
+/// only when the library is built with GFX_ENABLE_PAGE_FONTS.
+#define GFX_FONT_PAGES 0x02
+
+/// GFXfont::flags bits: glyph bitmaps are 2 or 4 bit coverage (fontconvert
+/// -a 2 or -a 4), row-major and MSB first like plain bits, 0 = untouched and
+/// all ones = solid. Partly covered pixels are blended from the text color
+/// toward the background color, so text should be drawn opaque on a known
+/// background; transparent text rounds coverage to on or off. Drawn only
+/// when the library is built with GFX_ENABLE_AA_FONTS.
+#define GFX_FONT_AA2 0x04
+#define GFX_FONT_AA4 0x08 ///< See GFX_FONT_AA2
+
+/// GFXfont::flags bit: text is UTF-8 and characters are Unicode code points
+/// up to U+FFFF (fontconvert -u), looked up through GFXfont::range. Other
+/// fonts, and these too unless the library is built with
+/// GFX_ENABLE_UTF8_FONTS, take text a byte per character.
+#define GFX_FONT_UTF8 0x10
+
+/// Most color changes in one row of a GFX_FONT_PACKED glyph
+#define GFX_FONT_PACKED_MAX_CHANGES 30
+
 /// Font data stored PER GLYPH
 typedef struct {
   uint16_t bitmapOffset; ///< Pointer into GFXfont->bitmap
@@ -17,13 +54,24 @@ typedef struct {
   int8_t yOffset;        ///< Y dist from cursor pos to UL corner
 } GFXglyph;
 
+/// Run of consecutive characters in a sparse font (fontconvert -c/-f/-u),
+/// in ascending order so a character's run can be found by binary search
+typedef struct {
+  uint16_t first; ///< First character of the run
+  uint16_t last;  ///< Last character of the run
+  uint16_t glyph; ///< Index in GFXfont->glyph of the first character
+} GFXrange;
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   uint8_t *bitmap;  ///< Glyph bitmaps, concatenated
   GFXglyph *glyph;  ///< Glyph array
-  uint8_t first;    ///< ASCII extents (first char)
-  uint8_t last;     ///< ASCII extents (last char)
+  uint8_t first;    ///< ASCII extents (first char), see range if sparse
+  uint8_t last;     ///< ASCII extents (last char), see range if sparse
   uint8_t yAdvance; ///< Newline distance (y axis)
+  uint8_t flags;    ///< GFX_FONT_* bitmap format flags, 0 for plain bits
+  GFXrange *range;  ///< Sparse glyph index, NULL if first-last are all there
+  uint8_t ranges;   ///< Number of entries in range
 } GFXfont;
 
 #endif // _GFXFONT_H_
@@ -0,0 +1,482 @@
+/*
+Image to Adafruit_GFX bitmap converter, fontconvert's counterpart for
+icons and splash screens.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool for preprocessing
+images to be used with the Adafruit_GFX Arduino library, so that drawing
+them at run time is just a copy.
+
+For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
+  ./imageconvert -p logo.png > logo.h
+
+Reads PNG (unless built with 'make NOPNG=1') and binary or ASCII PNM:
+PBM, PGM and PPM.  Transparent pixels count as black.  The table is
+named after the file (logo_data, logo_width, logo_height) unless -n
+gives a name.  Output formats:
+  (default)  1 bit per pixel, rows of (w + 7) / 8 bytes MSB first, for
+             drawBitmap(); as Adafruit_SSD1306's scripts/make_splash.py
+  -p         1 bit per pixel in the SSD1306's page-major layout, for
+             drawPageBitmap(); as make_splash.py -p
+  -r         drawBitmap() layout, PackBits run-length coded, for
+             drawRLEBitmap(); logos typically shrink by a quarter or more
+  -c         RGB565, for drawRGBBitmap() on color displays
+
+1-bit pixels are set where the image is at least -t (default 128) gray,
+or with -d, dithered: -d fs for Floyd-Steinberg error diffusion (photos,
+gradients), -d ordered for a 4x4 Bayer pattern (no crawling when images
+change).  -d also dithers RGB565 down from 8 bits per channel.  -i
+inverts.
+
+Several images are converted at once with -o, each to its own header in
+the given directory, in parallel:
+  ./imageconvert -p -o ../../../include/icons icons/a.png icons/b.png
+*/
+#ifndef ARDUINO
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef USE_LIBPNG
+#include <png.h>
+#endif
+
+enum { ROWS, PAGES, RLE, RGB565 };
+enum { DITHER_NONE, DITHER_FS, DITHER_ORDERED };
+
+typedef struct {
+  int w, h;
+  uint8_t *rgba; // 4 bytes per pixel, row-major
+} Image;
+
+// Next number in a PNM header or ASCII raster, skipping # comments;
+// PBM rasters (digits = 1) may run their 0s and 1s together
+static int pnmNumber(FILE *fp, int digits) {
+  int c, n = 0;
+  while (((c = getc(fp)) != EOF) && (isspace(c) || (c == '#'))) {
+    if (c == '#')
+      while (((c = getc(fp)) != EOF) && (c != '\n'))
+        ;
+  }
+  if (!isdigit(c))
+    return -1;
+  do {
+    n = n * 10 + c - '0';
+  } while ((--digits != 0) && isdigit(c = getc(fp)));
+  if (digits) // Leave the delimiter, binary rasters start after one
+    ungetc(c, fp);
+  return n;
+}
+
+static int readPNM(FILE *fp, Image *img) {
+  int type = getc(fp), maxval = 1, x, y, c, k;
+  int channels = ((type == '3') || (type == '6')) ? 3 : 1;
+
+  img->w = pnmNumber(fp, 0);
+  img->h = pnmNumber(fp, 0);
+  if ((type != '1') && (type != '4'))
+    maxval = pnmNumber(fp, 0);
+  if ((img->w <= 0) || (img->h <= 0) || (maxval <= 0) || (maxval > 65535))
+    return 0;
+  if ((type >= '4') && !isspace(getc(fp))) // One space before raster
+    return 0;
+  if (!(img->rgba = malloc(img->w * img->h * 4)))
+    return 0;
+
+  for (y = 0; y < img->h; y++) {
+    int bits = 0;
+    for (x = 0; x < img->w; x++) {
+      uint8_t *px = &img->rgba[(y * img->w + x) * 4];
+      for (k = 0; k < channels; k++) {
+        if (type == '1') {
+          c = !pnmNumber(fp, 1); // PBM 1 is black
+        } else if (type == '4') {
+          if (!(x & 7))
+            bits = getc(fp);
+          c = !(bits & (0x80 >> (x & 7)));
+        } else if (type <= '3') {
+          c = pnmNumber(fp, 0);
+        } else {
+          c = getc(fp);
+          if (maxval > 255)
+            c = (c << 8) | getc(fp);
+        }
+        if ((c < 0) || (c > maxval)) {
+          free(img->rgba);
+          return 0;
+        }
+        px[k] = (c * 255 + maxval / 2) / maxval;
+      }
+      if (channels == 1)
+        px[1] = px[2] = px[0];
+      px[3] = 255;
+    }
+  }
+  return 1;
+}
+
+#ifdef USE_LIBPNG
+static int readPNG(const char *path, Image *img) {
+  png_image png;
+  memset(&png, 0, sizeof png);
+  png.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_file(&png, path))
+    return 0;
+  png.format = PNG_FORMAT_RGBA;
+  img->w = png.width;
+  img->h = png.height;
+  if (!(img->rgba = malloc(PNG_IMAGE_SIZE(png)))) {
+    png_image_free(&png);
+    return 0;
+  }
+  if (!png_image_finish_read(&png, NULL, img->rgba, 0, NULL)) {
+    free(img->rgba);
+    return 0;
+  }
+  return 1;
+}
+#endif
+
+static int loadImage(const char *path, Image *img) {
+  FILE *fp = fopen(path, "rb");
+  int ok = 0, c;
+
+  if (!fp) {
+    fprintf(stderr, "Can't open %s\n", path);
+    return 0;
+  }
+  c = getc(fp);
+  if (c == 'P') {
+    ok = readPNM(fp, img);
+  } else if (c == 0x89) {
+#ifdef USE_LIBPNG
+    ok = readPNG(path, img);
+#else
+    fprintf(stderr, "%s: PNG support not built in\n", path);
+    fclose(fp);
+    return 0;
+#endif
+  }
+  fclose(fp);
+  if (!ok)
+    fprintf(stderr, "%s: not a readable PNG or PNM image\n", path);
+  return ok;
+}
+
+// Reduce one channel plane (0-255 values, alpha already applied) to levels
+// steps in place, returning step numbers 0 to levels - 1
+static void quantize(int *v, int w, int h, int levels, int dither,
+                     int threshold) {
+  static const uint8_t bayer[4][4] = {
+      {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+  int x, y, q, err;
+
+  for (y = 0; y < h; y++) {
+    for (x = 0; x < w; x++) {
+      int *p = &v[y * w + x];
+      if (dither == DITHER_ORDERED) {
+        q = (*p * (levels - 1) * 32 + (bayer[y & 3][x & 3] * 2 + 1) * 255) /
+            (255 * 32);
+      } else if (levels == 2) {
+        q = (*p >= threshold);
+      } else {
+        q = (*p * (levels - 1) + 127) / 255;
+      }
+      q = (q < 0) ? 0 : (q >= levels) ? levels - 1 : q;
+      if (dither == DITHER_FS) {
+        err = *p - q * 255 / (levels - 1);
+        if (x + 1 < w)
+          p[1] += err * 7 / 16;
+        if (y + 1 < h) {
+          if (x > 0)
+            p[w - 1] += err * 3 / 16;
+          p[w] += err * 5 / 16;
+          if (x + 1 < w)
+            p[w + 1] += err / 16;
+        }
+      }
+      *p = q;
+    }
+  }
+}
+
+// Write a byte table as make_splash.py does: 1-bit rows as binary
+// literals, anything else as hex, perLine to a line and a new line at
+// least every lineEnd bytes
+static void printBytes(const uint8_t *b, int n, int binary, int perLine,
+                       int lineEnd) {
+  int i, k, col = 0;
+  for (i = 0; i < n; i++) {
+    if (!col)
+      printf("  ");
+    if (binary) {
+      putchar('B');
+      for (k = 7; k >= 0; k--)
+        putchar('0' + ((b[i] >> k) & 1));
+      putchar(',');
+    } else {
+      printf("0x%02X,", b[i]);
+    }
+    if ((++col == perLine) || !((i + 1) % lineEnd) || (i + 1 == n)) {
+      putchar('\n');
+      col = 0;
+    }
+  }
+}
+
+// PackBits as drawRLEBitmap() reads it, returns coded length
+static int packBits(const uint8_t *src, int n, uint8_t *out) {
+  int i = 0, j, len = 0;
+  while (i < n) {
+    int run = 1;
+    while ((i + run < n) && (run < 128) && (src[i + run] == src[i]))
+      run++;
+    if (run >= 2) {
+      out[len++] = 257 - run;
+      out[len++] = src[i];
+      i += run;
+      continue;
+    }
+    // Copy up to the next run of three, where a repeat code pays off
+    for (j = i + 1; (j < n) && (j - i < 128); j++) {
+      if ((j + 2 < n) && (src[j] == src[j + 1]) && (src[j] == src[j + 2]))
+        break;
+    }
+    out[len++] = j - i - 1;
+    memcpy(&out[len], &src[i], j - i);
+    len += j - i;
+    i = j;
+  }
+  return len;
+}
+
+static int convert(const char *path, const char *name, int format, int dither,
+                   int threshold, int invert) {
+  Image img;
+  int x, y, k, n, planes = (format == RGB565) ? 3 : 1;
+  int *v;
+
+  if (!loadImage(path, &img))
+    return 1;
+  n = img.w * img.h;
+  if (!(v = malloc(n * planes * sizeof(int)))) {
+    fprintf(stderr, "Out of memory\n");
+    return 1;
+  }
+
+  // Composite over black, then gray for 1 bit or channel planes for RGB565
+  for (k = 0; k < n; k++) {
+    uint8_t *px = &img.rgba[k * 4];
+    int c[3];
+    for (x = 0; x < 3; x++) {
+      c[x] = px[x] * px[3] / 255;
+      if (invert)
+        c[x] = 255 - c[x];
+    }
+    if (planes == 1)
+      v[k] = (c[0] * 299 + c[1] * 587 + c[2] * 114 + 500) / 1000;
+    else
+      for (x = 0; x < 3; x++)
+        v[x * n + k] = c[x];
+  }
+  free(img.rgba);
+
+  printf("\n"
+         "#define %s_width  %d\n"
+         "#define %s_height %d\n"
+         "\n",
+         name, img.w, name, img.h);
+
+  if (format == RGB565) {
+    quantize(v, img.w, img.h, 32, dither, threshold);
+    quantize(&v[n], img.w, img.h, 64, dither, threshold);
+    quantize(&v[2 * n], img.w, img.h, 32, dither, threshold);
+    printf("// RGB565, for drawRGBBitmap()\n"
+           "const uint16_t PROGMEM %s_data[] = {\n",
+           name);
+    for (k = 0; k < n; k++) {
+      printf("%s0x%04X,", (k % 8) ? "" : "  ",
+             (v[k] << 11) | (v[n + k] << 5) | v[2 * n + k]);
+      if (!((k + 1) % 8) || (k + 1 == n))
+        putchar('\n');
+    }
+    printf("};\n");
+    free(v);
+    return 0;
+  }
+
+  quantize(v, img.w, img.h, 2, dither, threshold);
+
+  if (format == PAGES) {
+    int pages = (img.h + 7) / 8;
+    uint8_t *b = calloc(pages * img.w, 1);
+    for (y = 0; y < img.h; y++)
+      for (x = 0; x < img.w; x++)
+        if (v[y * img.w + x])
+          b[(y / 8) * img.w + x] |= 1 << (y & 7);
+    printf("// Page-major: %d bands of %d column bytes, LSB at top\n"
+           "const uint8_t PROGMEM %s_data[] = {\n",
+           pages, img.w, name);
+    printBytes(b, pages * img.w, 0, 16, img.w);
+    free(b);
+  } else {
+    int bw = (img.w + 7) / 8;
+    uint8_t *b = calloc(bw * img.h, 1), *rle;
+    for (y = 0; y < img.h; y++)
+      for (x = 0; x < img.w; x++)
+        if (v[y * img.w + x])
+          b[y * bw + x / 8] |= 0x80 >> (x & 7);
+    if (format == RLE) {
+      // Worst case one header byte per 128 copied
+      rle = malloc(bw * img.h + (bw * img.h + 127) / 128);
+      n = packBits(b, bw * img.h, rle);
+      printf("// PackBits, %d bytes coded from %d, for drawRLEBitmap()\n"
+             "const uint8_t PROGMEM %s_data[] = {\n",
+             n, bw * img.h, name);
+      printBytes(rle, n, 0, 16, n);
+      free(rle);
+    } else {
+      printf("const uint8_t PROGMEM %s_data[] = {\n", name);
+      printBytes(b, bw * img.h, 1, bw, bw);
+    }
+    free(b);
+  }
+  printf("};\n");
+  free(v);
+  return 0;
+}
+
+// Table name from the file name: directory and extension dropped, and
+// anything not valid in a C identifier made '_'
+static char *nameFor(const char *path) {
+  const char *base = strrchr(path, '/');
+  char *name = strdup(base ? base + 1 : path), *p;
+  if ((p = strrchr(name, '.')))
+    *p = 0;
+  for (p = name; *p; p++)
+    if (!isalnum((unsigned char)*p))
+      *p = '_';
+  if (isdigit((unsigned char)name[0]))
+    name[0] = '_';
+  return name;
+}
+
+int main(int argc, char *argv[]) {
+  int i, format = ROWS, dither = DITHER_NONE, threshold = 128, invert = 0;
+  const char *prog = argv[0], *outDir = NULL, *name = NULL;
+
+  // Parse command line.  Valid syntax is:
+  //   imageconvert [options] imagefile [imagefile...]
+  // Options:
+  //   -p           SSD1306 page-major, for drawPageBitmap()
+  //   -r           Run-length coded rows, for drawRLEBitmap()
+  //   -c           RGB565, for drawRGBBitmap()
+  //   -d fs|ordered  Dither: Floyd-Steinberg or 4x4 Bayer
+  //   -t level     1-bit threshold gray level, 1-255, without -d
+  //   -i           Invert (light pixels off)
+  //   -n name      Table name, for a single image
+  //   -o dir       Directory for one header per image, converted in
+  //                parallel; needed for more than one image
+
+  while ((i = getopt(argc, argv, "prcd:t:in:o:")) != -1) {
+    switch (i) {
+    case 'p':
+      format = PAGES;
+      break;
+    case 'r':
+      format = RLE;
+      break;
+    case 'c':
+      format = RGB565;
+      break;
+    case 'd':
+      if (!strcmp(optarg, "fs"))
+        dither = DITHER_FS;
+      else if (!strcmp(optarg, "ordered"))
+        dither = DITHER_ORDERED;
+      else
+        argc = 0; // Print usage
+      break;
+    case 't':
+      threshold = atoi(optarg);
+      if ((threshold < 1) || (threshold > 255))
+        argc = 0;
+      break;
+    case 'i':
+      invert = 1;
+      break;
+    case 'n':
+      name = optarg;
+      break;
+    case 'o':
+      outDir = optarg;
+      break;
+    default:
+      argc = 0; // Print usage
+      break;
+    }
+  }
+
+  if ((argc <= optind) || ((argc - optind > 1) && (!outDir || name))) {
+    fprintf(stderr,
+            "Usage: %s [-p|-r|-c] [-d fs|ordered] [-t level] [-i] "
+            "[-n name] [-o dir] imagefile [imagefile...]\n",
+            prog);
+    return 1;
+  }
+
+  if (!outDir)
+    return convert(argv[optind], name ? name : nameFor(argv[optind]), format,
+                   dither, threshold, invert);
+
+  // Batch: one child per image, as many at once as there are cores
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  int running = 0, failed = 0, status;
+
+  for (i = optind; (i < argc) || running;) {
+    if ((i < argc) && (running < cores)) {
+      pid_t pid = fork();
+      if (pid < 0) {
+        perror("fork");
+        return 1;
+      }
+      if (!pid) {
+        // Written beside the header and renamed over it only once whole,
+        // so a failed image leaves neither an empty nor a clobbered header
+        char *id = name ? strdup(name) : nameFor(argv[i]), path[1024],
+             tmp[1028];
+        snprintf(path, sizeof path, "%s/%s.h", outDir, id);
+        snprintf(tmp, sizeof tmp, "%s.tmp", path);
+        if (!freopen(tmp, "w", stdout)) {
+          perror(tmp);
+          _exit(1);
+        }
+        int rc = convert(argv[i], id, format, dither, threshold, invert);
+        if (fclose(stdout) && !rc) {
+          perror(tmp);
+          rc = 1;
+        }
+        if (!rc && rename(tmp, path)) {
+          perror(path);
+          rc = 1;
+        }
+        if (rc)
+          unlink(tmp);
+        _exit(rc);
+      }
+      running++;
+      i++;
+    } else {
+      wait(&status);
+      running--;
+      if (!WIFEXITED(status) || WEXITSTATUS(status))
+        failed = 1;
+    }
+  }
+  return failed;
+}
+
+#endif /* !ARDUINO */
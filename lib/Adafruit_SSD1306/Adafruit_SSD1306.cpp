@@ -170,6 +170,7 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi,
 #if ARDUINO >= 157
   , wireClk(clkDuring), restoreClk(clkAfter)
 #endif
+  , pixelFunc(&Adafruit_SSD1306::drawPixelRotated<0>)
 {
 }
 
@@ -204,7 +205,7 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h,
   int8_t mosi_pin, int8_t sclk_pin, int8_t dc_pin, int8_t rst_pin,
   int8_t cs_pin) : Adafruit_GFX(w, h), spi(NULL), wire(NULL), buffer(NULL),
   mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin), csPin(cs_pin),
-  rstPin(rst_pin) {
+  rstPin(rst_pin), pixelFunc(&Adafruit_SSD1306::drawPixelRotated<0>) {
 }
 
 /*!
@@ -236,7 +237,8 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h,
 Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass *spi,
   int8_t dc_pin, int8_t rst_pin, int8_t cs_pin, uint32_t bitrate) :
   Adafruit_GFX(w, h), spi(spi ? spi : &SPI), wire(NULL), buffer(NULL),
-  mosiPin(-1), clkPin(-1), dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin) {
+  mosiPin(-1), clkPin(-1), dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin),
+  pixelFunc(&Adafruit_SSD1306::drawPixelRotated<0>) {
 #ifdef SPI_HAS_TRANSACTION
   spiSettings = SPISettings(bitrate, MSBFIRST, SPI_MODE0);
 #endif
@@ -272,7 +274,8 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t mosi_pin, int8_t sclk_pin,
   int8_t dc_pin, int8_t rst_pin, int8_t cs_pin) :
   Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT), spi(NULL), wire(NULL),
   buffer(NULL), mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin),
-  csPin(cs_pin), rstPin(rst_pin) {
+  csPin(cs_pin), rstPin(rst_pin),
+  pixelFunc(&Adafruit_SSD1306::drawPixelRotated<0>) {
 }
 
 /*!
@@ -299,7 +302,8 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t mosi_pin, int8_t sclk_pin,
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t dc_pin, int8_t rst_pin,
   int8_t cs_pin) : Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT),
   spi(&SPI), wire(NULL), buffer(NULL), mosiPin(-1), clkPin(-1),
-  dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin) {
+  dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin),
+  pixelFunc(&Adafruit_SSD1306::drawPixelRotated<0>) {
 #ifdef SPI_HAS_TRANSACTION
   spiSettings = SPISettings(8000000, MSBFIRST, SPI_MODE0);
 #endif
@@ -322,7 +326,7 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t dc_pin, int8_t rst_pin,
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t rst_pin) :
   Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT), spi(NULL), wire(&Wire),
   buffer(NULL), mosiPin(-1), clkPin(-1), dcPin(-1), csPin(-1),
-  rstPin(rst_pin) {
+  rstPin(rst_pin), pixelFunc(&Adafruit_SSD1306::drawPixelRotated<0>) {
 }
 
 /*!
@@ -375,8 +379,10 @@ void Adafruit_SSD1306::ssd1306_command1(uint8_t c) {
 }
 
 // Issue list of commands to SSD1306, same rules as above re: transactions.
+// The list is in PROGMEM unless inRAM is set.
 // This is a private function, not exposed.
-void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
+void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n,
+  bool inRAM) {
   if(wire) { // I2C
     wire->beginTransmission(i2caddr);
     WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
@@ -388,13 +394,13 @@ void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
         WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
         bytesOut = 1;
       }
-      WIRE_WRITE(pgm_read_byte(c++));
+      WIRE_WRITE(inRAM ? *c++ : pgm_read_byte(c++));
       bytesOut++;
     }
     wire->endTransmission();
   } else { // SPI -- transaction started in calling function
     SSD1306_MODE_COMMAND
-    while(n--) SPIwrite(pgm_read_byte(c++));
+    while(n--) SPIwrite(inRAM ? *c++ : pgm_read_byte(c++));
   }
 }
 
@@ -461,7 +467,7 @@ boolean Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, boolean reset,
   if(HEIGHT > 32) {
     // drawBitmap((WIDTH - splash1_width) / 2, (HEIGHT - splash1_height) / 2,
     //   splash1_data, splash1_width, splash1_height, 1);
-    drawBitmap((WIDTH - UTS1_width) / 2, (HEIGHT - UTS1_height) / 2,
+    drawPageBitmap((WIDTH - UTS1_width) / 2, (HEIGHT - UTS1_height) / 2,
     UTS1_data, UTS1_width, UTS1_height, 1);
   } else {
     drawBitmap((WIDTH - splash2_width) / 2, (HEIGHT - splash2_height) / 2,
@@ -584,6 +590,17 @@ boolean Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, boolean reset,
 
 // DRAWING FUNCTIONS -------------------------------------------------------
 
+// Grow the region display() has to send to take in the (already clipped,
+// raw) rectangle x1,y1 to x2,y2 inclusive. An empty region is 0xFF,0xFF
+// to 0,0, so the first mark simply replaces it.
+inline void Adafruit_SSD1306::markDirty(int16_t x1, int16_t y1, int16_t x2,
+  int16_t y2) {
+  if(x1 < dirtyX1) dirtyX1 = x1;
+  if(y1 < dirtyY1) dirtyY1 = y1;
+  if(x2 > dirtyX2) dirtyX2 = x2;
+  if(y2 > dirtyY2) dirtyY2 = y2;
+}
+
 /*!
     @brief  Set/clear/invert a single pixel. This is also invoked by the
             Adafruit_GFX library in generating many higher-level graphics
@@ -600,22 +617,37 @@ boolean Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, boolean reset,
             commands as needed by one's own application.
 */
 void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if((x >= 0) && (x < width()) && (y >= 0) && (y < height())) {
-    // Pixel is in-bounds. Rotate coordinates if needed.
-    switch(getRotation()) {
-     case 1:
-      ssd1306_swap(x, y);
-      x = WIDTH - x - 1;
-      break;
-     case 2:
-      x = WIDTH  - x - 1;
-      y = HEIGHT - y - 1;
-      break;
-     case 3:
-      ssd1306_swap(x, y);
-      y = HEIGHT - y - 1;
-      break;
-    }
+  (this->*pixelFunc)(x, y, color);
+}
+
+/*!
+    @brief  Set/clear/invert a single pixel inside a startWrite()/endWrite()
+            pair. The SSD1306 has no transaction state of its own, so this
+            is the same as drawPixel() but saves Adafruit_GFX a second
+            virtual call per pixel.
+    @param  x
+            Column of display -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Row of display -- 0 at top to (screen height -1) at bottom.
+    @param  color
+            Pixel color, one of: SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERT.
+    @return None (void).
+*/
+void Adafruit_SSD1306::writePixel(int16_t x, int16_t y, uint16_t color) {
+  (this->*pixelFunc)(x, y, color);
+}
+
+// Per-rotation pixel writer. ROT is a compile-time constant, so each
+// instance contains only the transform it needs and the bounds check is
+// done once, against the raw (unrotated) buffer dimensions.
+template <uint8_t ROT>
+void Adafruit_SSD1306::drawPixelRotated(int16_t x, int16_t y,
+  uint16_t color) {
+  if(ROT & 1)              ssd1306_swap(x, y);
+  if((ROT == 1) || (ROT == 2)) x = WIDTH  - x - 1;
+  if(ROT >= 2)             y = HEIGHT - y - 1;
+  if(((uint16_t)x < (uint16_t)WIDTH) && ((uint16_t)y < (uint16_t)HEIGHT)) {
+    markDirty(x, y, x, y);
     switch(color) {
      case SSD1306_WHITE:   buffer[x + (y/8)*WIDTH] |=  (1 << (y&7)); break;
      case SSD1306_BLACK:   buffer[x + (y/8)*WIDTH] &= ~(1 << (y&7)); break;
@@ -624,6 +656,23 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
   }
 }
 
+/*!
+    @brief  Set rotation of the display, and select the matching pixel
+            writer so drawPixel() no longer has to check the rotation.
+    @param  r
+            0 thru 3 corresponding to 4 cardinal rotations.
+    @return None (void).
+*/
+void Adafruit_SSD1306::setRotation(uint8_t r) {
+  Adafruit_GFX::setRotation(r);
+  switch(rotation) {
+   case 0: pixelFunc = &Adafruit_SSD1306::drawPixelRotated<0>; break;
+   case 1: pixelFunc = &Adafruit_SSD1306::drawPixelRotated<1>; break;
+   case 2: pixelFunc = &Adafruit_SSD1306::drawPixelRotated<2>; break;
+   case 3: pixelFunc = &Adafruit_SSD1306::drawPixelRotated<3>; break;
+  }
+}
+
 /*!
     @brief  Clear contents of display buffer (set all pixels to off).
     @return None (void).
@@ -633,6 +682,9 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
 */
 void Adafruit_SSD1306::clearDisplay(void) {
   memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+  dirtyX1 = dirtyY1 = 0; // All of it now differs, and begin() relies on
+  dirtyX2 = WIDTH  - 1;  // this to set the region up in the first place
+  dirtyY2 = HEIGHT - 1;
 }
 
 /*!
@@ -693,6 +745,7 @@ void Adafruit_SSD1306::drawFastHLineInternal(
       w = (WIDTH - x);
     }
     if(w > 0) { // Proceed only if width is positive
+      markDirty(x, y, x + w - 1, y);
       uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x],
                mask = 1 << (y & 7);
       switch(color) {
@@ -762,6 +815,7 @@ void Adafruit_SSD1306::drawFastVLineInternal(
       __h = (HEIGHT - __y);
     }
     if(__h > 0) { // Proceed only if height is now positive
+      markDirty(x, __y, x, __y + __h - 1);
       // this display doesn't need ints for coordinates,
       // use local byte registers for faster juggling
       uint8_t  y = __y, h = __h;
@@ -833,6 +887,340 @@ void Adafruit_SSD1306::drawFastVLineInternal(
   } // endif x in bounds
 }
 
+/*!
+    @brief  Fill a rectangle. This is also invoked by the Adafruit_GFX
+            library for scaled text and filled shapes. The rectangle is
+            rotated once and then written a page (8 rows) at a time,
+            rather than one pixel or one line at a time.
+    @param  x
+            Leftmost column -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Topmost row -- 0 at top to (screen height - 1) at bottom.
+    @param  w
+            Width of rectangle, in pixels.
+    @param  h
+            Height of rectangle, in pixels.
+    @param  color
+            Fill color, one of: SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERT.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application.
+*/
+void Adafruit_SSD1306::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+  uint16_t color) {
+  // Zero and negative heights draw nothing, as drawFastVLine() here
+  if((h <= 0) || !rawRect(&x, &y, &w, &h)) return;
+  markDirty(x, y, x + w - 1, y + h - 1);
+
+  // Clipped values fit in a byte, use local byte registers as in
+  // drawFastVLineInternal()
+  uint8_t  y1   = y + h - 1, page = y / 8, lastPage = y1 / 8, n;
+  uint8_t  mask = 0xFF << (y & 7);
+  uint8_t *pBuf = &buffer[page * WIDTH + x];
+  for(;;) {
+    if(page == lastPage) mask &= 0xFF >> (7 - (y1 & 7));
+    uint8_t *p = pBuf;
+    n = w;
+    switch(color) {
+     case SSD1306_WHITE:   while(n--) { *p++ |=  mask; }; break;
+     case SSD1306_BLACK:   while(n--) { *p++ &= ~mask; }; break;
+     case SSD1306_INVERSE: while(n--) { *p++ ^=  mask; }; break;
+    }
+    if(page++ == lastPage) break;
+    pBuf += WIDTH;
+    mask  = 0xFF;
+  }
+}
+
+/*!
+    @brief  Draw a single character, writing the display buffer a glyph
+            column (one or more page bytes) at a time.
+    @param  x
+            Left edge of character cell.
+    @param  y
+            Top edge of character cell.
+    @param  c
+            8-bit font-indexed character (likely ascii), or a code point
+            with a GFX_FONT_UTF8 font.
+    @param  color
+            Text color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERT.
+    @param  bg
+            Background color, same as color for a transparent background.
+    @param  size_x
+            Horizontal magnification, 1 = original size.
+    @param  size_y
+            Vertical magnification, 1 = original size.
+    @return None (void).
+    @note   Only the built-in 'classic' font at 1X to 3X, with no rotation
+            and the whole cell on-screen, and custom fonts converted with
+            fontconvert -p (GFX_FONT_PAGES) at 1X are handled here; the
+            latter, built in with GFX_ENABLE_PAGE_FONTS, go through
+            drawPageBitmap() a glyph column at a time.
+            Page-aligned rows (y a multiple of 8) need no shifting at all.
+            Anything else (other custom fonts, other sizes, clipped classic
+            cells, an opaque background in SSD1306_INVERT) goes through
+            Adafruit_GFX::drawChar().
+*/
+void Adafruit_SSD1306::drawChar(int16_t x, int16_t y, uint16_t c,
+  uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+  boolean opaque = (bg != color);
+
+#ifdef GFX_ENABLE_PAGE_FONTS
+  const GFXglyph *g;
+  if(gfxFont && (size_x == 1) && (size_y == 1) &&
+     (pgm_read_byte(&gfxFont->flags) & GFX_FONT_PAGES) &&
+     (g = fontGlyph(c))) {
+    // Bands start pad rows above the glyph, aligned to the cursor's pages
+    int8_t  yo  = pgm_read_byte(&g->yOffset);
+    uint8_t pad = yo & 7, h = pgm_read_byte(&g->height);
+    if(h) {
+      drawPageBitmap(x + (int8_t)pgm_read_byte(&g->xOffset), y + yo - pad,
+        fontBitmap(g), pgm_read_byte(&g->width), pad + h, color);
+    }
+    return;
+  }
+#endif
+
+  if(gfxFont || rotation || (size_x != size_y) || !size_x || (size_x > 3) ||
+     (x < 0) || (y < 0) ||
+     ((x + 6 * size_x) > WIDTH) || ((y + 8 * size_y) > HEIGHT) ||
+     (color > (opaque ? SSD1306_WHITE : SSD1306_INVERSE)) ||
+     (opaque && (bg > SSD1306_WHITE))) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+
+  // Nibble to byte with each bit doubled, for 2X glyph columns
+  static const uint8_t PROGMEM dblbits[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF };
+
+  const uint8_t *glyph = classicGlyph(c);
+  uint8_t        shift = y & 7, cols = opaque ? 6 : 5; // Opaque fills gap
+  uint32_t       mask  = ((1UL << (8 * size_x)) - 1) << shift; // <= 31 bits
+  uint8_t       *pBuf  = &buffer[(y / 8) * WIDTH + x];
+
+  markDirty(x, y, x + 6 * size_x - 1, y + 8 * size_y - 1);
+  for(uint8_t i=0; i<cols; i++) {
+    uint16_t line = (i < 5) ? pgm_read_byte(&glyph[i]) : 0;
+    if(!opaque && !line) { // Nothing to draw in this column
+      pBuf += size_x;
+      continue;
+    }
+    uint32_t bits = line;
+    if(size_x == 2) {
+      bits = pgm_read_byte(&dblbits[line & 0x0F]) |
+        ((uint16_t)pgm_read_byte(&dblbits[line >> 4]) << 8);
+    } else if(size_x == 3) { // Each bit tripled
+      bits = 0;
+      for(int8_t b=7; b>=0; b--)
+        bits = (bits << 3) | (((line >> b) & 1) ? 7 : 0);
+    }
+    bits <<= shift;
+    // Opaque cells replace every bit under the mask; for black-on-white
+    // that's the complement of the glyph
+    if(opaque && (color == SSD1306_BLACK)) bits = mask & ~bits;
+    for(uint8_t n=size_x; n--; pBuf++) {
+      uint32_t b = bits, m = mask;
+      uint8_t *p = pBuf;
+      do {
+        if(opaque) {
+          *p = (*p & ~(uint8_t)m) | (uint8_t)b;
+        } else {
+          switch(color) {
+           case SSD1306_WHITE:   *p |=  (uint8_t)b; break;
+           case SSD1306_BLACK:   *p &= ~(uint8_t)b; break;
+           case SSD1306_INVERSE: *p ^=  (uint8_t)b; break;
+          }
+        }
+        p += WIDTH;
+        b >>= 8;
+      } while(m >>= 8);
+    }
+  }
+}
+
+// Transpose an 8x8 block of pixels from GFXcanvas1 rows (MSB = leftmost
+// pixel) to SSD1306 columns (LSB = top pixel). This is the three-step
+// swap from Hacker's Delight 7-3, with rows loaded bottom-up so that row
+// order comes out LSB-first.
+static void transpose8(const uint8_t *rows, uint8_t *cols) {
+  uint32_t x, y, t;
+
+  x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) |
+      ((uint16_t)rows[5] << 8)  | rows[4];
+  y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) |
+      ((uint16_t)rows[1] << 8)  | rows[0];
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+
+  cols[0] = t >> 24; cols[1] = t >> 16; cols[2] = t >> 8; cols[3] = t;
+  cols[4] = y >> 24; cols[5] = y >> 16; cols[6] = y >> 8; cols[7] = y;
+}
+
+/*!
+    @brief  Copy a monochrome canvas into the display buffer. Set canvas
+            pixels become SSD1306_WHITE and clear ones SSD1306_BLACK.
+    @param  x
+            Column of display for the canvas' left edge, may be negative.
+    @param  y
+            Row of display for the canvas' top edge, may be negative.
+    @param  canvas
+            Canvas to copy, as seen through its own rotation.
+    @return None (void).
+    @note   With neither the display nor the canvas rotated, the canvas is
+            converted 8x8 pixels at a time and merged into the page bytes
+            it covers. Otherwise each pixel is copied individually.
+            Changes buffer contents only, no immediate effect on display.
+*/
+void Adafruit_SSD1306::drawCanvas(int16_t x, int16_t y,
+  const GFXcanvas1 &canvas) {
+  const uint8_t *src = canvas.getBuffer();
+  int16_t        w   = canvas.width(), h = canvas.height();
+
+  if(!src) return;
+
+  if(rotation || canvas.getRotation()) {
+    for(int16_t j=0; j<h; j++) {
+      for(int16_t i=0; i<w; i++) {
+        (this->*pixelFunc)(x + i, y + j,
+          canvas.getPixel(i, j) ? SSD1306_WHITE : SSD1306_BLACK);
+      }
+    }
+    return;
+  }
+
+  // Visible part of the canvas, in display coordinates
+  int16_t x1 = (x < 0) ? 0 : x, x2 = x + w - 1,
+          y1 = (y < 0) ? 0 : y, y2 = y + h - 1;
+  if(x2 >= WIDTH)  x2 = WIDTH  - 1;
+  if(y2 >= HEIGHT) y2 = HEIGHT - 1;
+  if((x1 > x2) || (y1 > y2)) return;
+  markDirty(x1, y1, x2, y2);
+
+  uint16_t stride = (w + 7) / 8;
+  uint8_t  rows[8], cols[8];
+
+  // Step through the canvas 8 rows at a time; each band lands across at
+  // most two pages of the display
+  for(int16_t r = ((y1 - y) / 8) * 8; r <= y2 - y; r += 8) {
+    int16_t  top   = y + r;                 // Display row of band's row 0
+    uint8_t  shift = top & 7;
+    int16_t  page  = (top - shift) / 8;     // Page holding band's row 0
+    uint16_t vmask = 0;                     // Band rows that are visible
+    for(uint8_t k=0; k<8; k++) {
+      if(((top + k) >= y1) && ((top + k) <= y2)) vmask |= 1 << k;
+    }
+    vmask <<= shift;
+
+    for(int16_t cb = (x1 - x) / 8; cb <= (x2 - x) / 8; cb++) {
+      for(uint8_t k=0; k<8; k++) {
+        rows[k] = (r + k < h) ? src[(r + k) * stride + cb] : 0;
+      }
+      transpose8(rows, cols);
+      for(uint8_t k=0; k<8; k++) {
+        int16_t col = x + cb * 8 + k;
+        if((col < x1) || (col > x2)) continue;
+        uint16_t bits = ((uint16_t)cols[k] << shift) & vmask;
+        uint8_t  m    = vmask;
+        if(m) {
+          uint8_t *p = &buffer[page * WIDTH + col];
+          *p = (*p & ~m) | (uint8_t)bits;
+        }
+        if((m = vmask >> 8)) {
+          uint8_t *p = &buffer[(page + 1) * WIDTH + col];
+          *p = (*p & ~m) | (uint8_t)(bits >> 8);
+        }
+      }
+    }
+  }
+}
+
+/*!
+    @brief  Draw a PROGMEM-resident bitmap stored in the display's own
+            page-major layout (see scripts/make_splash.py -p). Set bits
+            are drawn in the given color, clear bits are left alone.
+    @param  x
+            Column of display for the bitmap's left edge.
+    @param  y
+            Row of display for the bitmap's top edge.
+    @param  bitmap
+            Bitmap data: (h + 7) / 8 bands of w column bytes, LSB at top.
+    @param  w
+            Width of bitmap, in pixels.
+    @param  h
+            Height of bitmap, in pixels.
+    @param  color
+            Draw color, one of: SSD1306_BLACK, SSD1306_WHITE or
+            SSD1306_INVERT.
+    @return None (void).
+    @note   Unrotated, each bitmap byte is applied to the display buffer in
+            one go (two when y is not a multiple of 8). With rotation, each
+            pixel is drawn individually.
+            Changes buffer contents only, no immediate effect on display.
+*/
+void Adafruit_SSD1306::drawPageBitmap(int16_t x, int16_t y,
+  const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+
+  if(rotation) {
+    for(int16_t j=0; j<h; j++) {
+      const uint8_t *src = &bitmap[(j / 8) * w];
+      for(int16_t i=0; i<w; i++) {
+        if(pgm_read_byte(&src[i]) & (1 << (j & 7)))
+          (this->*pixelFunc)(x + i, y + j, color);
+      }
+    }
+    return;
+  }
+
+  // Visible part of the bitmap, in display coordinates
+  int16_t x1 = (x < 0) ? 0 : x, x2 = x + w - 1,
+          y1 = (y < 0) ? 0 : y, y2 = y + h - 1;
+  if(x2 >= WIDTH)  x2 = WIDTH  - 1;
+  if(y2 >= HEIGHT) y2 = HEIGHT - 1;
+  if((x1 > x2) || (y1 > y2)) return;
+  markDirty(x1, y1, x2, y2);
+
+  uint8_t shift = y & 7;
+  for(int16_t band = (y1 - y) / 8; band <= (y2 - y) / 8; band++) {
+    int16_t  top   = y + band * 8;          // Display row of band's bit 0
+    int16_t  page  = (top - shift) / 8;     // Page holding band's bit 0
+    uint16_t vmask = 0;                     // Band rows that are visible
+    for(uint8_t k=0; k<8; k++) {
+      if(((top + k) >= y1) && ((top + k) <= y2)) vmask |= 1 << k;
+    }
+    vmask <<= shift;
+
+    const uint8_t *src  = &bitmap[band * w + (x1 - x)];
+    uint8_t       *pBuf = &buffer[page * WIDTH + x1];
+    uint8_t        lo   = vmask, hi = vmask >> 8;
+    for(int16_t n = x2 - x1 + 1; n--; pBuf++) {
+      uint16_t bits = ((uint16_t)pgm_read_byte(src++) << shift) & vmask;
+      switch(color) {
+       case SSD1306_WHITE:
+        if(lo) pBuf[0]     |= (uint8_t)bits;
+        if(hi) pBuf[WIDTH] |= (uint8_t)(bits >> 8);
+        break;
+       case SSD1306_BLACK:
+        if(lo) pBuf[0]     &= ~(uint8_t)bits;
+        if(hi) pBuf[WIDTH] &= ~(uint8_t)(bits >> 8);
+        break;
+       case SSD1306_INVERSE:
+        if(lo) pBuf[0]     ^= (uint8_t)bits;
+        if(hi) pBuf[WIDTH] ^= (uint8_t)(bits >> 8);
+        break;
+      }
+    }
+  }
+}
+
 /*!
     @brief  Return color of a single pixel in display buffer.
     @param  x
@@ -870,8 +1258,11 @@ boolean Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
     @brief  Get base address of display buffer for direct reading or writing.
     @return Pointer to an unsigned 8-bit array, column-major, columns padded
             to full byte boundary if needed.
+    @note   As the buffer may then be changed directly, the next display()
+            sends the whole of it.
 */
 uint8_t *Adafruit_SSD1306::getBuffer(void) {
+  markDirty(0, 0, WIDTH - 1, HEIGHT - 1);
   return buffer;
 }
 
@@ -883,17 +1274,25 @@ uint8_t *Adafruit_SSD1306::getBuffer(void) {
     @note   Drawing operations are not visible until this function is
             called. Call after each graphics command, or after a whole set
             of graphics commands, as best needed by one's own application.
+            Only the pages and columns changed since the previous call are
+            sent; if nothing has changed, nothing is sent.
 */
 void Adafruit_SSD1306::display(void) {
+  if(dirtyX1 > dirtyX2) return; // Panel already matches buffer
+
+  uint8_t  page1 = dirtyY1 / 8, pages = dirtyY2 / 8 - page1 + 1,
+           cols  = dirtyX2 - dirtyX1 + 1;
+  uint8_t *ptr   = &buffer[page1 * WIDTH + dirtyX1];
+
   TRANSACTION_START
-  static const uint8_t PROGMEM dlist1[] = {
+  uint8_t dlist1[] = {
     SSD1306_PAGEADDR,
-    0,                         // Page start address
-    0xFF,                      // Page end (not really, but works here)
+    page1,                        // Page start address
+    (uint8_t)(page1 + pages - 1), // Page end address
     SSD1306_COLUMNADDR,
-    0 };                       // Column start address
-  ssd1306_commandList(dlist1, sizeof(dlist1));
-  ssd1306_command1(WIDTH - 1); // Column end address
+    dirtyX1,                      // Column start address
+    dirtyX2 };                    // Column end address
+  ssd1306_commandList(dlist1, sizeof(dlist1), true);
 
 #if defined(ESP8266)
   // ESP8266 needs a periodic yield() call to avoid watchdog reset.
@@ -904,31 +1303,37 @@ void Adafruit_SSD1306::display(void) {
   // 32-byte transfer condition below.
   yield();
 #endif
-  uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
-  uint8_t *ptr   = buffer;
   if(wire) { // I2C
     wire->beginTransmission(i2caddr);
     WIRE_WRITE((uint8_t)0x40);
     uint8_t bytesOut = 1;
-    while(count--) {
-      if(bytesOut >= WIRE_MAX) {
-        wire->endTransmission();
-        wire->beginTransmission(i2caddr);
-        WIRE_WRITE((uint8_t)0x40);
-        bytesOut = 1;
+    while(pages--) {
+      for(uint8_t n=cols; n--; ) {
+        if(bytesOut >= WIRE_MAX) {
+          wire->endTransmission();
+          wire->beginTransmission(i2caddr);
+          WIRE_WRITE((uint8_t)0x40);
+          bytesOut = 1;
+        }
+        WIRE_WRITE(*ptr++);
+        bytesOut++;
       }
-      WIRE_WRITE(*ptr++);
-      bytesOut++;
+      ptr += WIDTH - cols;
     }
     wire->endTransmission();
   } else { // SPI
     SSD1306_MODE_DATA
-    while(count--) SPIwrite(*ptr++);
+    while(pages--) {
+      for(uint8_t n=cols; n--; ) SPIwrite(*ptr++);
+      ptr += WIDTH - cols;
+    }
   }
   TRANSACTION_END
 #if defined(ESP8266)
   yield();
 #endif
+  dirtyX1 = dirtyY1 = 0xFF; // Nothing pending
+  dirtyX2 = dirtyY2 = 0;
 }
 
 // SCROLLING FUNCTIONS -----------------------------------------------------
@@ -1053,6 +1458,8 @@ void Adafruit_SSD1306::stopscroll(void) {
   TRANSACTION_START
   ssd1306_command1(SSD1306_DEACTIVATE_SCROLL);
   TRANSACTION_END
+  // Scrolling moved the panel's contents, display() must resend it all
+  markDirty(0, 0, WIDTH - 1, HEIGHT - 1);
 }
 
 // OTHER HARDWARE SETTINGS -------------------------------------------------
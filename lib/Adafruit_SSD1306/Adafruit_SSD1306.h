@@ -147,6 +147,16 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
   void         invertDisplay(boolean i);
   void         dim(boolean dim);
   void         drawPixel(int16_t x, int16_t y, uint16_t color);
+  void         writePixel(int16_t x, int16_t y, uint16_t color);
+  void         fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint16_t color);
+  void         setRotation(uint8_t r);
+  using        Adafruit_GFX::drawChar;
+  void         drawChar(int16_t x, int16_t y, uint16_t c, uint16_t color,
+                 uint16_t bg, uint8_t size_x, uint8_t size_y);
+  void         drawCanvas(int16_t x, int16_t y, const GFXcanvas1 &canvas);
+  void         drawPageBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                 int16_t w, int16_t h, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   void         startscrollright(uint8_t start, uint8_t stop);
@@ -164,8 +174,12 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
                  uint16_t color);
   void         drawFastVLineInternal(int16_t x, int16_t y, int16_t h,
                  uint16_t color);
+  template <uint8_t ROT>
+  void         drawPixelRotated(int16_t x, int16_t y, uint16_t color);
+  void         markDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
   void         ssd1306_command1(uint8_t c);
-  void         ssd1306_commandList(const uint8_t *c, uint8_t n);
+  void         ssd1306_commandList(const uint8_t *c, uint8_t n,
+                 bool inRAM = false);
 
   SPIClass    *spi;
   TwoWire     *wire;
@@ -181,6 +195,13 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
   uint32_t     restoreClk; // Wire speed following SSD1306 transfers
 #endif
   uint8_t      contrast;    // normal contrast setting for this device
+  // drawPixelRotated<> instance matching the current rotation, selected
+  // once in setRotation() rather than switched on for every pixel
+  void        (Adafruit_SSD1306::*pixelFunc)(int16_t x, int16_t y,
+                 uint16_t color);
+  // Raw (unrotated) bounds of buffer changes not yet sent by display(),
+  // empty when dirtyX1 > dirtyX2. First set by clearDisplay() in begin().
+  uint8_t      dirtyX1, dirtyY1, dirtyX2, dirtyY2;
 #if defined(SPI_HAS_TRANSACTION)
 protected:
   // Allow sub-class to change
@@ -29,10 +29,48 @@ def main(fn, id):
     print()
   print("};")
 
+# Same, but in the SSD1306's own layout (for drawPageBitmap()): each byte
+# is 8 pixels of a column, LSB at top, and each 8-row band of the image
+# is a run of width bytes
+def main_pages(fn, id):
+  image = Image.open(fn)
+  pages = (image.height + 7)//8
+  print("\n"
+        "#define {id}_width  {w}\n"
+        "#define {id}_height {h}\n"
+        "\n"
+        "// Page-major: {p} bands of {w} column bytes, LSB at top\n"
+        "const uint8_t PROGMEM {id}_data[] = {{\n"
+        .format(id=id, w=image.width, h=image.height, p=pages), end='')
+  for page in range(0, pages):
+    for x in range(0, image.width):
+      if x % 16 == 0:
+        print("  ", end='')
+
+      byte = 0
+      for bit in range(0, 8):
+        y = page * 8 + bit
+        if y < image.height and image.getpixel((x,y)) != 0:
+          byte |= 1 << bit
+      print("0x{:02X},".format(byte), end='')
+
+      if x % 16 == 15 or x == image.width - 1:
+        print()
+  print("};")
+
 if __name__ == '__main__':
-    if len(sys.argv) < 3:
-      print("Usage: {} <imagefile> <id>\n".format(sys.argv[0]), file=sys.stderr);
+    args = sys.argv[1:]
+    pages = len(args) > 0 and args[0] == '-p'
+    if pages:
+      args = args[1:]
+    if len(args) < 2:
+      print("Usage: {} [-p] <imagefile> <id>\n"
+            "  -p  page-major output for drawPageBitmap()\n"
+            .format(sys.argv[0]), file=sys.stderr);
       sys.exit(1)
-    fn = sys.argv[1]
-    id = sys.argv[2]
-    main(fn, id)
+    fn = args[0]
+    id = args[1]
+    if pages:
+      main_pages(fn, id)
+    else:
+      main(fn, id)
@@ -2,62 +2,64 @@
 #define UTS1_width  128
 #define UTS1_height 55
 
+// Page-major: 7 bands of 128 column bytes, LSB at top
 const uint8_t PROGMEM UTS1_data[] = {
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B11000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000001,B11100000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000011,B11110000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000111,B11111000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000111,B11111000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000111,B11110000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00100011,B11100001,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B01110001,B11000011,B10000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B11111111,B11111111,B11000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000001,B11111111,B11111111,B11100000,B00000011,B11111000,B00001111,B11100000,B11111111,B11111111,B11110000,B00000111,B11111100,B00000000,B00000000,
-  B00000000,B00000011,B11111111,B11111111,B11100000,B00000011,B11111100,B00001111,B11100000,B11111111,B11111111,B11110000,B00011111,B11111111,B00000000,B00000000,
-  B00000000,B00000001,B11111111,B11111111,B11100000,B00000011,B11111100,B00001111,B11100000,B11111111,B11111111,B11110000,B00111111,B11111111,B10000000,B00000000,
-  B00000000,B00000000,B11111111,B11111111,B11000000,B00000011,B11111100,B00001111,B11100000,B11111111,B11111111,B11110000,B01111111,B11111111,B11000000,B00000000,
-  B00000000,B00000000,B01110011,B11100111,B10000000,B00000011,B11111100,B00001111,B11100000,B11111111,B11111111,B11110000,B11111111,B11111111,B11000000,B00000000,
-  B00000000,B00000000,B00100011,B11100011,B00000000,B00000011,B11111100,B00001111,B11100000,B11111111,B11111111,B11110000,B11111111,B11111111,B11100000,B00000000,
-  B00000000,B00000000,B00000011,B11100000,B00000000,B00000011,B11111100,B00001111,B11100000,B11111111,B11111111,B11110001,B11111111,B00111111,B11100000,B00000000,
-  B00000000,B00000000,B00000011,B11100000,B00000000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000001,B11111110,B00011111,B11100000,B00000000,
-  B00000000,B00000000,B00000011,B11100000,B00000000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000001,B11111100,B00001111,B11100000,B00000000,
-  B00000000,B00000000,B00000011,B11100000,B00000000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000001,B11111110,B00001111,B11100000,B00000000,
-  B00000000,B00000011,B10000111,B11110000,B11100000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000001,B11111111,B00000000,B00000000,B00000000,
-  B00000000,B00000111,B11001111,B11111001,B11110000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B11111111,B11100000,B00000000,B00000000,
-  B00000000,B00001111,B11111111,B11111111,B11111000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B11111111,B11111000,B00000000,B00000000,
-  B00000000,B00000111,B11111111,B11111111,B11111000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B11111111,B11111110,B00000000,B00000000,
-  B00000000,B00000011,B11111111,B11111111,B11110000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B01111111,B11111111,B10000000,B00000000,
-  B00000000,B00000001,B11111111,B00111111,B11100000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B00111111,B11111111,B11000000,B00000000,
-  B00000000,B00000001,B11111110,B00111111,B11000000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B00011111,B11111111,B11100000,B00000000,
-  B00000000,B00000011,B11111111,B01111111,B11100000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B00000111,B11111111,B11100000,B00000000,
-  B00000000,B00000111,B11111111,B11111111,B11110000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B00000000,B11111111,B11100000,B00000000,
-  B00000000,B00001111,B11111111,B11111111,B11111000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000000,B00000000,B00111111,B11110000,B00000000,
-  B00000000,B00000111,B11101111,B11111101,B11111000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000001,B11111100,B00001111,B11110000,B00000000,
-  B00000000,B00000011,B11000111,B11111000,B11110000,B00000011,B11111100,B00001111,B11100000,B00000011,B11111100,B00000001,B11111100,B00001111,B11110000,B00000000,
-  B00000000,B00000001,B11001111,B11111000,B11100000,B00000011,B11111100,B00011111,B11100000,B00000011,B11111100,B00000001,B11111100,B00001111,B11110000,B00000000,
-  B00000000,B00000001,B11111111,B11111101,B11000000,B00000011,B11111100,B00011111,B11100000,B00000011,B11111100,B00000001,B11111100,B00001111,B11110000,B00000000,
-  B00000000,B00000011,B11111111,B01111111,B11100000,B00000011,B11111111,B11111111,B11100000,B00000011,B11111100,B00000001,B11111111,B00011111,B11100000,B00000000,
-  B00000000,B00000011,B11111111,B01111111,B11110000,B00000001,B11111111,B11111111,B11000000,B00000011,B11111100,B00000001,B11111111,B11111111,B11100000,B00000000,
-  B00000000,B00000011,B11111111,B00111111,B11100000,B00000001,B11111111,B11111111,B11000000,B00000011,B11111100,B00000000,B11111111,B11111111,B11100000,B00000000,
-  B00000000,B00000001,B11111110,B00011111,B11000000,B00000000,B11111111,B11111111,B10000000,B00000011,B11111100,B00000000,B11111111,B11111111,B11000000,B00000000,
-  B00000000,B00000000,B11111111,B01111111,B10000000,B00000000,B01111111,B11111111,B00000000,B00000011,B11111100,B00000000,B01111111,B11111111,B10000000,B00000000,
-  B00000000,B00000000,B00111111,B11111110,B00000000,B00000000,B00111111,B11111110,B00000000,B00000011,B11111100,B00000000,B00011111,B11111111,B00000000,B00000000,
-  B00000000,B00000000,B00011111,B11111100,B00000000,B00000000,B00001111,B11111000,B00000000,B00000011,B11111100,B00000000,B00000111,B11111100,B00000000,B00000000,
-  B00000000,B00000000,B00011111,B11111100,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00001111,B11111000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000111,B11110000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000011,B11100000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
-  B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,B00000000,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xC0,0xE0,0xF0,0xF8,0xF8,0xF0,0xE0,0xC0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x70,
+  0xF8,0xFC,0xFE,0xFC,0xF8,0xF9,0xFB,0xFF,0xFF,0xFF,0xFB,0xF9,0xF8,0xF8,0xFC,0xFE,
+  0xFC,0xF8,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,
+  0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x80,0xC0,0xE0,0xE0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,
+  0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,
+  0xC0,0x81,0x03,0x01,0x80,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x80,0x01,0x03,0x83,
+  0xC1,0xC0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x07,0x07,0x07,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,0x7C,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xC7,0x83,0x83,0x87,0x0F,0x3F,0x3F,0x3F,0x3F,
+  0x3F,0x3F,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xC3,0xE7,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xC7,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xEF,0xC7,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x03,0x07,0x0F,0x1F,0x1F,0x3F,0x3F,0x3F,0x7F,0x7F,0xFF,0xFF,0xFF,0xFE,0xFE,0xFC,
+  0xFC,0xF8,0xF0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x73,0xFF,
+  0xFF,0xFF,0xF9,0xF8,0xFD,0xFF,0xFF,0x7F,0x0F,0x3F,0x7F,0xFF,0xFF,0xF9,0xF0,0xF9,
+  0xFF,0xFF,0x77,0x23,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x7F,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xF0,0xF0,0xF0,0xF0,0xFC,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0x7F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xF0,0xE0,0xE0,0xE0,0xF0,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0x7F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x01,0x03,0x0F,0x1F,0x3F,0x7F,0x7F,0x7E,0x7F,0x7F,0x3F,0x1F,0x0F,0x03,0x01,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x03,0x03,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x03,0x03,0x01,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,
+  0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x01,0x01,0x03,0x03,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x03,0x03,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 };
 
 
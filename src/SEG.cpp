@@ -0,0 +1,176 @@
+/*! @file
+ *
+ *  @brief Large 7-segment numeral readout for the display
+ *
+ *  @author agent
+ *  @date 2026-10-19
+ */
+
+#include "SEG.h"
+
+// Segment bits, a is the top bar and the rest follow clockwise, g is middle
+//
+//    aaa
+//   f   b
+//    ggg
+//   e   c
+//    ddd
+#define SEG_A 0x01
+#define SEG_B 0x02
+#define SEG_C 0x04
+#define SEG_D 0x08
+#define SEG_E 0x10
+#define SEG_F 0x20
+#define SEG_G 0x40
+#define SEG_ALL 0x7F
+
+// Segments lit for each decimal digit
+const uint8_t PROGMEM SEG_DIGITS[] =
+    {
+        SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F,         // 0
+        SEG_B | SEG_C,                                         // 1
+        SEG_A | SEG_B | SEG_D | SEG_E | SEG_G,                 // 2
+        SEG_A | SEG_B | SEG_C | SEG_D | SEG_G,                 // 3
+        SEG_B | SEG_C | SEG_F | SEG_G,                         // 4
+        SEG_A | SEG_C | SEG_D | SEG_F | SEG_G,                 // 5
+        SEG_A | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G,         // 6
+        SEG_A | SEG_B | SEG_C,                                 // 7
+        SEG_ALL,                                               // 8
+        SEG_A | SEG_B | SEG_C | SEG_D | SEG_F | SEG_G};        // 9
+
+#define SEG_MINUS SEG_G
+
+void SEG_init(SEG_Readout_t *readout, int16_t x, int16_t y, uint8_t w,
+              uint8_t h, uint8_t t, uint8_t gap, uint8_t digits)
+{
+  readout->x = x;
+  readout->y = y;
+  readout->w = w;
+  readout->h = h;
+  readout->t = t;
+  readout->gap = gap;
+  readout->digits = (digits > SEG_MAX_DIGITS) ? SEG_MAX_DIGITS : digits;
+  SEG_invalidate(readout);
+}
+
+void SEG_invalidate(SEG_Readout_t *readout)
+{
+  for (uint8_t i = 0; i < SEG_MAX_DIGITS; i++)
+  {
+    readout->shown[i] = SEG_INVALID;
+  }
+}
+
+/*! @brief Fills one segment of a digit
+ *
+ *  @param display  display to draw on
+ *  @param r        readout the digit belongs to
+ *  @param x        x coordinate of the top-left of the digit
+ *  @param seg      segment bit, one of SEG_A to SEG_G
+ *  @param color    color to fill with
+ *
+ *  @return  void
+ */
+static void fillSegment(Adafruit_GFX *display, const SEG_Readout_t *r,
+                        int16_t x, uint8_t seg, uint16_t color)
+{
+  int16_t t = r->t, w = r->w, h = r->h, y = r->y;
+  int16_t mid = (h - t) / 2; // Top of the middle bar
+
+  switch (seg)
+  {
+  case SEG_A:
+    display->fillRect(x + t, y, w - 2 * t, t, color);
+    break;
+  case SEG_B:
+    display->fillRect(x + w - t, y + t, t, mid - t, color);
+    break;
+  case SEG_C:
+    display->fillRect(x + w - t, y + mid + t, t, h - mid - 2 * t, color);
+    break;
+  case SEG_D:
+    display->fillRect(x + t, y + h - t, w - 2 * t, t, color);
+    break;
+  case SEG_E:
+    display->fillRect(x, y + mid + t, t, h - mid - 2 * t, color);
+    break;
+  case SEG_F:
+    display->fillRect(x, y + t, t, mid - t, color);
+    break;
+  case SEG_G:
+    display->fillRect(x + t, y + mid, w - 2 * t, t, color);
+    break;
+  default:
+    break;
+  }
+}
+
+bool SEG_draw(Adafruit_GFX *display, SEG_Readout_t *readout, int value,
+              uint16_t color, uint16_t bg)
+{
+  uint8_t want[SEG_MAX_DIGITS];
+  uint8_t n = readout->digits;
+  bool neg = (value < 0);
+  unsigned int mag = neg ? -(unsigned int)value : value;
+  int8_t i = n - 1;
+
+  if (n == 0)
+  {
+    return false;
+  }
+
+  // Right-align the digits, then the sign, blank the rest
+  do
+  {
+    want[i--] = pgm_read_byte(&SEG_DIGITS[mag % 10]);
+    mag /= 10;
+  } while (mag && (i >= 0));
+  bool fits = (mag == 0);
+  if (neg)
+  {
+    if (i >= 0)
+    {
+      want[i--] = SEG_MINUS;
+    }
+    else
+    {
+      fits = false;
+    }
+  }
+  if (!fits)
+  {
+    // Too wide for the readout
+    i = n - 1;
+    while (i >= 0)
+    {
+      want[i--] = SEG_MINUS;
+    }
+  }
+  while (i >= 0)
+  {
+    want[i--] = 0;
+  }
+
+  bool drew = false;
+  int16_t x = readout->x;
+  for (uint8_t d = 0; d < n; d++, x += readout->w + readout->gap)
+  {
+    uint8_t changed = (readout->shown[d] == SEG_INVALID)
+                          ? SEG_ALL
+                          : (want[d] ^ readout->shown[d]);
+    if (!changed)
+    {
+      continue;
+    }
+    for (uint8_t seg = SEG_A; seg <= SEG_G; seg <<= 1)
+    {
+      if (changed & seg)
+      {
+        fillSegment(display, readout, x, seg, (want[d] & seg) ? color : bg);
+      }
+    }
+    readout->shown[d] = want[d];
+    drew = true;
+  }
+  return drew;
+}
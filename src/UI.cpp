@@ -7,80 +7,142 @@
  */
 
 #include "UI.h"
+#include "SEG.h"
+
+// Pass a PROGMEM char array to functions taking F("") strings
+#ifndef FPSTR
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper *>(p))
+#endif
 
 // Array of defined UI btns
 uint8_t BTNS[] = {BTN_UP, BTN_SELECT,
                   BTN_DOWN, BTN_BACK};
 
 uint16union_t Display_State;                  // Current state of display
+bool Display_Ok = false;                      // Set once the display has begun
 const uint8_t PROGMEM MAX_MAINSTATE = 2;      // Max number of Main menu states
 uint8_t MAX_SUBSTATE[MAX_MAINSTATE] = {2, 2}; // Max number of substates per main state
 
-// Speed setting to display based on the value of target_speed
-const String PROGMEM SPEED_DISP[] =
+// Value of target_speed that is shown as speed 0
+const uint8_t PROGMEM SPEED_ZERO = 6;
+
+// Large readout for the speed setting, centred between the menu arrows.
+// Two 16x28 digits, enough for a minus sign and one digit
+SEG_Readout_t Speed_Readout;
+
+// Main menu up/down arrows: the fillTriangle()s they replace, pre-rendered
+// in the display's page-major layout for drawPageBitmap()
+const uint8_t PROGMEM ARROW_SIZE = 11; // Width and height, in pixels
+const uint8_t PROGMEM ARROW_UP[] =
     {
-        "-6",
-        "-5", "-4", "-3", "-2", "-1",
-        "0",
-        "1", "2", "3", "4", "5",
-        "6"};
+        0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00,
+        0x04, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04};
+const uint8_t PROGMEM ARROW_DOWN[] =
+    {
+        0x03, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x03,
+        0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00};
 
 // Emergency stop state
 bool Emerg_Stop = false;
 
-/*! @brief Calculates and prints the current string centered around x, y pos
+// Snapshot of everything UI_updateDisplay() draws from
+typedef struct
+{
+  uint16_t state; // Display_State
+  int targetSpeed;
+  bool emergStop;
+} UIView_t;
+
+/*! @brief Prints the current string centered around x, y pos
+ *
+ *  Lines are broken to the display width and each one is centered. The
+ *  layout is cached by the display, so static labels are only measured once.
  * 
- *  @param buf  address of the string to be printed
+ *  @param buf  address of the string to be printed, stored in flash
  *  @param x    x coordinate to center horizontally
  *  @param y    y coordinate to center veritcally
  *
  *  @return  void
  */
-void drawCentreString(const String &buf, int x, int y, Adafruit_SSD1306 *display)
+void drawCentreString(const __FlashStringHelper *buf, int x, int y, Adafruit_SSD1306 *display)
 {
-  int16_t x1, y1;
-  uint16_t w, h;
-  display->getTextBounds(buf, 0, 0, &x1, &y1, &w, &h); //calc width of new string
-  display->setCursor(x - (w / 2), y - (h / 2));
-  display->print(buf);
+  int16_t w = display->width(), h = display->height();
+  display->drawText(buf, x - (w / 2), y - (h / 2), w, h, GFX_ALIGN_CENTER);
+}
+
+/*! @brief Draws the up and down arrows of the main menu format
+ *
+ *  @param display pointer to the display handle
+ *
+ *  @return  void
+ */
+void drawMenuArrows(Adafruit_SSD1306 *display)
+{
+  uint8_t dispQuartH = display->height() / 4;
+  uint8_t dispHalfW = display->width() / 2;
+
+  // Top Triangle
+  display->drawPageBitmap(
+      dispHalfW - 5, dispQuartH - 10,
+      ARROW_UP, ARROW_SIZE, ARROW_SIZE, SSD1306_WHITE);
+
+  //Bottom Triangle
+  display->drawPageBitmap(
+      dispHalfW - 5, (dispQuartH * 3),
+      ARROW_DOWN, ARROW_SIZE, ARROW_SIZE, SSD1306_WHITE);
 }
 
 /*! @brief Displays passed string in the main menu format
  * 
  *  That is the string centered with an up and down arrow surrounding it 
  * 
- *  @param buf  address of the string to be printed
+ *  @param buf  address of the string to be printed, stored in flash
  *  @param display pointer to the display handle
  *
  *  @return  void
  */
-void mainMenuDisplay(const String &buf, Adafruit_SSD1306 *display)
+void mainMenuDisplay(const __FlashStringHelper *buf, Adafruit_SSD1306 *display)
 {
   display->clearDisplay();
 
-  uint8_t dispQuartH = display->height() / 4;
-  uint8_t dispHalfW = display->width() / 2;
-  uint8_t dispHalfH = display->height() / 2;
-
-  // Top Triangle
-  display->fillTriangle(
-      dispHalfW, dispQuartH - 10,
-      dispHalfW - 5, dispQuartH,
-      dispHalfW + 5, dispQuartH, SSD1306_WHITE);
+  drawMenuArrows(display);
 
   display->setTextSize(2);
   display->setTextColor(SSD1306_WHITE);
-  drawCentreString(buf, dispHalfW, dispHalfH, display);
-
-  //Bottom Triangle
-  display->fillTriangle(
-      dispHalfW, (dispQuartH * 3) + 10,
-      dispHalfW - 5, (dispQuartH * 3),
-      dispHalfW + 5, (dispQuartH * 3), SSD1306_WHITE);
+  drawCentreString(buf, display->width() / 2, display->height() / 2, display);
 
   display->display();
 }
 
+/*! @brief Displays the speed setting on the large readout in the main menu
+ *         format
+ *
+ *  Only the readout segments that changed are redrawn, and only they are
+ *  sent to the panel, so this is cheap enough to call at the control rate.
+ *
+ *  @param speed    speed setting to show, -6 to 6
+ *  @param full     true to redraw the whole screen, false if the screen
+ *                  already shows the readout
+ *  @param display  pointer to the display handle
+ *
+ *  @return  void
+ */
+void speedDisplay(int speed, bool full, Adafruit_SSD1306 *display)
+{
+  if (full)
+  {
+    display->clearDisplay();
+    drawMenuArrows(display);
+    SEG_invalidate(&Speed_Readout);
+  }
+
+  if (SEG_draw(display, &Speed_Readout, speed, SSD1306_WHITE, SSD1306_BLACK) ||
+      full)
+  {
+    display->display();
+  }
+}
+
 /*! @brief Checks if the desired speed is valid and updates targetSpeed
  * 
  *  @param targetSpeed  pointer to the value of the current target speed setting
@@ -109,6 +171,14 @@ void updateValue(uint8_t btn, int *targetSpeed)
   uint8_t *subState = &Display_State.s.Lo;
   int increment = 0;
 
+  // Any btn skips the boot screens, so emergency stop is a press or two away
+  if (*mainState == 0)
+  {
+    *mainState = 1;
+    *subState = 1;
+    return;
+  }
+
   if (*subState == 1)
   {
     switch (btn)
@@ -192,7 +262,7 @@ void updateValue(uint8_t btn, int *targetSpeed)
     switch (*subState)
     {
     case 2:
-      Serial.println("btn press");
+      Serial.println(F("btn press"));
       Emerg_Stop = !Emerg_Stop;
       if (Emerg_Stop)
       {
@@ -208,7 +278,7 @@ void updateValue(uint8_t btn, int *targetSpeed)
   }
 }
 
-void UI_init(Adafruit_SSD1306 *display)
+bool UI_init(Adafruit_SSD1306 *display)
 {
   //Config Buttons
   pinMode(BTN_UP, INPUT);
@@ -221,39 +291,115 @@ void UI_init(Adafruit_SSD1306 *display)
   if (!display->begin(SSD1306_SWITCHCAPVCC, 0x3C))
   { // Address 0x3C for 128x32
     Serial.println(F("SSD1306 allocation failed"));
-    for (;;)
-      ; // Don't proceed, loop forever
+    // Carry on without the display so speed control keeps running; the
+    // btns still work, from the main menu as the boot screens can't show
+    Display_State.s.Hi = 1;
+    Display_State.s.Lo = 1;
+    return false;
   }
   Serial.println(F("SSD1306 allocation succes"));
+  Display_Ok = true;
 
-  // Show initial display buffer contents on the screen --
-  // the library initializes this with an Adafruit splash screen.
-  display->display();
-  delay(2000); // Pause for 2 seconds
+  SEG_init(&Speed_Readout, display->width() / 2 - 18, 18, 16, 28, 4, 4, 2);
 
-  // Clear the buffer
-  display->clearDisplay();
+  // Splash and version screens are shown by UI_updateDisplay(), so that
+  // the control loop keeps running while they are up
+  Display_State.s.Hi = 0;
+  Display_State.s.Lo = 1;
+  return true;
+}
 
-  // Display Current Firmware Version
-  display->setTextSize(2);
-  display->setTextColor(SSD1306_WHITE);
-  drawCentreString(SW_VER, display->width() / 2, display->height() / 2, display);
+/*! @brief Shows the boot screens in turn, each for UI_BOOT_SCREEN_PERIOD ms
+ *
+ *  Boot screens are mainState 0: subState 1 is the splash screen begin()
+ *  leaves in the display buffer, subState 2 the firmware version. Moves on
+ *  to the main menu once the last has been shown for its period.
+ *
+ *  @param display pointer to the display handle
+ *
+ *  @return  true while a boot screen is showing
+ */
+bool bootDisplay(Adafruit_SSD1306 *display)
+{
+  static unsigned long shownAt = 0;
+  static uint8_t shown = 0; // subState on the panel, 0 before the first
+  uint8_t *subState = &Display_State.s.Lo;
 
-  // Show the display buffer on the screen. You MUST call display() after
-  // drawing commands to make them visible on screen!
-  display->display();
-  delay(2000);
+  if (shown == *subState)
+  {
+    if (millis() - shownAt < UI_BOOT_SCREEN_PERIOD)
+    {
+      return true;
+    }
+    if (*subState == 2)
+    {
+      Display_State.s.Hi = 1;
+      Display_State.s.Lo = 1;
+      return false;
+    }
+    *subState = *subState + 1;
+  }
 
-  Display_State.s.Hi = 1;
-  Display_State.s.Lo = 1;
+  switch (*subState)
+  {
+  // Splash
+  case 1:
+    display->display();
+    break;
+  // Current Firmware Version
+  case 2:
+    display->clearDisplay();
+    display->setTextSize(2);
+    display->setTextColor(SSD1306_WHITE);
+    drawCentreString(FPSTR(SW_VER), display->width() / 2, display->height() / 2, display);
+    display->display();
+    break;
+  default:
+    break;
+  }
+  shown = *subState;
+  shownAt = millis();
+  return true;
 }
 
 void UI_updateDisplay(Adafruit_SSD1306 *display, int targetSpeed)
 {
+  if (!Display_Ok)
+  {
+    return;
+  }
+  if ((Display_State.s.Hi == 0) && bootDisplay(display))
+  {
+    return;
+  }
+
+  static UIView_t lastView;
+  static unsigned long lastDraw = 0;
+  static bool drawn = false;
+
+  UIView_t view = {Display_State.l, targetSpeed, Emerg_Stop};
+
+  // Redraw the whole screen when it changes, and periodically in case the
+  // panel has been disturbed
+  bool full = !drawn || (view.state != lastView.state) ||
+              (view.emergStop != lastView.emergStop) ||
+              (millis() - lastDraw >= UI_REFRESH_PERIOD);
+
+  // Skip the redraw if the screen would come out the same
+  if (!full && (view.targetSpeed == lastView.targetSpeed))
+  {
+    return;
+  }
+  lastView = view;
+  if (full)
+  {
+    lastDraw = millis();
+    drawn = true;
+  }
+
   uint8_t mainState = Display_State.s.Hi;
   uint8_t subState = Display_State.s.Lo;
-  // 0 is an invalid mainState
-  String value;
+  // mainState 0 is the boot screens, handled by bootDisplay()
 
   switch (mainState)
   {
@@ -272,7 +418,7 @@ void UI_updateDisplay(Adafruit_SSD1306 *display, int targetSpeed)
       }
       else
       {
-        mainMenuDisplay(SPEED_DISP[targetSpeed], display);
+        speedDisplay(targetSpeed - SPEED_ZERO, full, display);
       }
       break;
     default:
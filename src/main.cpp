@@ -176,6 +176,13 @@ void setup()
 
   PWMInit();
 
+  // Take the first control sample before the display is brought up, and
+  // report how long after reset that was
+  maintainSpeed();
+  Serial.print(F("First control sample at "));
+  Serial.print(micros());
+  Serial.println(F(" us"));
+
   UI_init(&display);
 }
 
@@ -0,0 +1,316 @@
+// Times each GFX primitive on GFXcanvas1/8/16, the SSD1306 and an SPITFT
+// panel, in the manner of Google Benchmark: every case is repeated until
+// it has run for the minimum time, then reported as time per op, ops/s and
+// pixels/s. Pixels are those the op sets when drawn once on a clear
+// GFXcanvas1. The DejaVu cases compare anti-aliased text with 1 bpp text
+// of the same face, so they run on the color targets only.
+//
+// Usage: bench [filter] [seconds]   runs the cases whose name contains
+//                                   filter, each for at least seconds
+//                                   (0.1 by default)
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <time.h>
+
+#include "fonts/DejaVuSans9pt7b.h"
+#include "mock_tft.h"
+
+// Trees from before anti-aliased glyphs time the 1 bpp DejaVu cases only
+#ifdef GFX_FONT_AA4
+#include "fonts/DejaVuSans9pt7bAA2.h"
+#include "fonts/DejaVuSans9pt7bAA4.h"
+#endif
+
+// Trees from before the seven-segment readout only have the text version
+#if __has_include("SEG.h")
+#include "SEG.h"
+#define HAVE_SEG 1
+#endif
+
+#define W 128
+#define H 64
+
+static const uint8_t icon[] PROGMEM = {
+    0x18, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x7F,
+    0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFE,
+    0x01, 0xFF, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x18};
+
+typedef void (*Op)(Adafruit_GFX &g, uint32_t i);
+
+struct Case {
+  const char *name;
+  Op op;
+  uint8_t rotation;
+  bool partial; // Redraws only what changed, so has no pixels per op
+};
+
+// Each rotation maps pixels to the buffer differently; ops stay inside
+// the 64x64 square all four have in common
+static void pixel(Adafruit_GFX &g, uint32_t i) {
+  g.drawPixel(i & 63, (i >> 6) & 63, 1);
+}
+
+// A screenful of text at size: 8 lines of 21 characters at size 1, 4 of
+// 10 at size 2 as the UI draws them, 2 of 7 at size 3
+static void textFrame(Adafruit_GFX &g, uint32_t i, uint8_t size) {
+  static const char text[] = "Speed -6 Emerg Stop  ";
+  uint8_t cols = 21 / size, rows = 8 / size;
+  char line[22];
+  g.fillScreen(0);
+  g.setCursor(0, 0);
+  g.setTextColor(1);
+  g.setTextSize(size);
+  for (uint8_t j = 0; j < rows; j++) {
+    for (uint8_t k = 0; k < cols; k++)
+      line[k] = text[(i + j + k) % 21];
+    line[cols] = '\0';
+    g.println(line);
+  }
+}
+
+// Three lines of 9pt text, white on black; anti-aliased glyphs blend their
+// edges into the black, 1 bpp ones have no background
+static void fontFrame(Adafruit_GFX &g, uint32_t i) {
+  static const char text[] = "Speed -6 Emerg Stop  ";
+  char line[13];
+  g.fillScreen(0);
+  g.setCursor(0, 14);
+  g.setTextColor(0xFFFF, 0);
+  for (uint8_t j = 0; j < 3; j++) {
+    for (uint8_t k = 0; k < 12; k++)
+      line[k] = text[(i + j + k) % 21];
+    line[12] = '\0';
+    g.println(line);
+  }
+}
+
+// The speed readout as the UI drew it before the seven-segment digits:
+// clear the value's box, then print it at size 2
+static void readoutText(Adafruit_GFX &g, uint32_t i) {
+  g.fillRect(W / 2 - 18, 18, 36, 28, 0);
+  g.setCursor(W / 2 - 12, 24);
+  g.setTextSize(2);
+  g.setTextColor(1);
+  g.print((int)(i % 13) - 6);
+}
+
+#ifdef HAVE_SEG
+// The UI's readout, 2 digits of 16x28, and a 4 digit one of 28x56
+static SEG_Readout_t speed, large;
+
+static void initReadouts(void) {
+  SEG_init(&speed, W / 2 - 18, 18, 16, 28, 4, 4, 2);
+  SEG_init(&large, 2, 4, 28, 56, 6, 4, 4);
+}
+#endif
+
+// Ops take the iteration count so that positions and text vary a little,
+// and a cached result can't stand in for the work
+static const Case cases[] = {
+    {"drawPixel/r0", pixel, 0},
+    {"drawPixel/r1", pixel, 1},
+    {"drawPixel/r2", pixel, 2},
+    {"drawPixel/r3", pixel, 3},
+    {"drawFastHLine", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawFastHLine(3 + (i & 7), (i >> 3) & (H - 1), 100, 1);
+     }},
+    {"drawFastVLine", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawFastVLine((i >> 3) & (W - 1), 3 + (i & 7), 50, 1);
+     }},
+    {"fillRect", [](Adafruit_GFX &g, uint32_t i) {
+       g.fillRect(3 + (i & 7), 5, 100, 50, 1);
+     }},
+    {"drawLine", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawLine(i & 7, 0, 120, 63 - (i & 7), 1);
+     }},
+    {"drawCircle", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawCircle(64 + (i & 7), 32, 28, 1);
+     }},
+    {"fillCircle", [](Adafruit_GFX &g, uint32_t i) {
+       g.fillCircle(64 + (i & 7), 32, 28, 1);
+     }},
+    {"fillTriangle", [](Adafruit_GFX &g, uint32_t i) {
+       g.fillTriangle(i & 7, 60, 64, 2, 127 - (i & 7), 50, 1);
+     }},
+    {"drawRoundRect", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawRoundRect(4 + (i & 7), 4, 100, 50, 8, 1);
+     }},
+    {"drawBitmap", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawBitmap(50 + (i & 7), 20, icon, 16, 16, 1);
+     }},
+    {"drawChar/classic/1", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 20, 'A' + (i & 15), 1, 1, 1);
+     }},
+    {"drawChar/classic/2", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 20, 'A' + (i & 15), 1, 1, 2);
+     }},
+    {"drawChar/classic/3", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 20, 'A' + (i & 15), 1, 1, 3);
+     }},
+    {"drawChar/FreeSans9pt/1", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 40, 'A' + (i & 15), 1, 1, 1);
+     }},
+    {"drawChar/FreeSans9pt/2", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 40, 'A' + (i & 15), 1, 1, 2);
+     }},
+    {"drawChar/FreeSans9pt/3", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 60, 'A' + (i & 15), 1, 1, 3);
+     }},
+    {"drawChar/DejaVu9pt/1", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 40, 'A' + (i & 15), 0xFFFF, 0, 1);
+     }},
+#ifdef GFX_FONT_AA4
+    {"drawChar/DejaVu9pt-aa2/1", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 40, 'A' + (i & 15), 0xFFFF, 0, 1);
+     }},
+    {"drawChar/DejaVu9pt-aa4/1", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 40, 'A' + (i & 15), 0xFFFF, 0, 1);
+     }},
+    {"drawChar/DejaVu9pt-aa4/2", [](Adafruit_GFX &g, uint32_t i) {
+       g.drawChar(20 + (i & 7), 40, 'A' + (i & 15), 0xFFFF, 0, 2);
+     }},
+#endif
+    {"getTextBounds", [](Adafruit_GFX &g, uint32_t i) {
+       int16_t x, y;
+       uint16_t w, h;
+       char s[] = "Speed -6 ENABLED";
+       s[7] = '0' + (i & 7);
+       g.getTextBounds(s, 0, 20, &x, &y, &w, &h);
+     }},
+    {"frame/text/1", [](Adafruit_GFX &g, uint32_t i) { textFrame(g, i, 1); }},
+    {"frame/text/2", [](Adafruit_GFX &g, uint32_t i) { textFrame(g, i, 2); }},
+    {"frame/text/3", [](Adafruit_GFX &g, uint32_t i) { textFrame(g, i, 3); }},
+    {"frame/text/DejaVu9pt", fontFrame},
+#ifdef GFX_FONT_AA4
+    {"frame/text/DejaVu9pt-aa2", fontFrame},
+    {"frame/text/DejaVu9pt-aa4", fontFrame},
+#endif
+    {"readout/text/2", readoutText},
+#ifdef HAVE_SEG
+    {"readout/seg", [](Adafruit_GFX &g, uint32_t i) {
+       SEG_draw(&g, &speed, (int)(i % 13) - 6, 1, 0);
+     },
+     0, true},
+    {"readout/seg/same", [](Adafruit_GFX &g, uint32_t i) {
+       SEG_draw(&g, &speed, -6, 1, 0);
+     },
+     0, true},
+    {"readout/seg/large", [](Adafruit_GFX &g, uint32_t i) {
+       SEG_draw(&g, &large, (int)(i * 7 % 10999) - 999, 1, 0);
+     },
+     0, true},
+#endif
+};
+
+struct Target {
+  const char *name;
+  Adafruit_GFX *g;
+  bool color; // Takes 16-bit colors (GFXcanvas8 keeps the low byte)
+};
+
+// Fonts by the tag in a case's name, first match
+static const struct {
+  const char *tag;
+  const GFXfont *font;
+} fonts[] = {{"FreeSans9pt", &FreeSans9pt7b},
+#ifdef GFX_FONT_AA4
+             {"DejaVu9pt-aa2", &DejaVuSans9pt7bAA2},
+             {"DejaVu9pt-aa4", &DejaVuSans9pt7bAA4},
+#endif
+             {"DejaVu9pt", &DejaVuSans9pt7b}};
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void setUp(Adafruit_GFX &g, const Case &c) {
+  g.setRotation(c.rotation);
+  g.fillScreen(0);
+  g.setTextWrap(false);
+  g.setTextSize(1);
+  g.setFont(NULL);
+  for (const auto &f : fonts) {
+    if (strstr(c.name, f.tag)) {
+      g.setFont(f.font);
+      break;
+    }
+  }
+#ifdef HAVE_SEG
+  initReadouts(); // Nothing drawn yet
+#endif
+}
+
+// Pixels one op sets, counted on a clear canvas
+static unsigned pixels(const Case &c) {
+  if (c.partial)
+    return 0;
+  GFXcanvas1 canvas(W, H);
+  setUp(canvas, c);
+  c.op(canvas, 0);
+  unsigned n = 0;
+  for (uint16_t i = 0; i < W * H / 8; i++)
+    n += __builtin_popcount(canvas.getBuffer()[i]);
+  return n;
+}
+
+// Run op in doubling batches until it has taken seconds, returning s/op
+static double timeOp(Adafruit_GFX &g, Op op, double seconds) {
+  uint32_t i = 0;
+  double start = now(), t;
+  for (uint32_t n = 16;; n *= 2) {
+    for (uint32_t end = i + n; i < end; i++)
+      op(g, i);
+    if ((t = now() - start) >= seconds)
+      return t / i;
+  }
+}
+
+static bool match(const char *filter, const char *name, const char *target) {
+  char full[96];
+  snprintf(full, sizeof full, "%s/%s", name, target);
+  return !filter || strstr(full, filter);
+}
+
+static void report(const char *name, const char *target, double s,
+                   unsigned px) {
+  char full[96];
+  snprintf(full, sizeof full, "%s/%s", name, target);
+  printf("%-36s %10.1f ns %12.4g ops/s", full, s * 1e9, 1 / s);
+  if (px)
+    printf(" %12.4g px/s", px / s);
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  const char *filter = (argc > 1) && *argv[1] ? argv[1] : NULL;
+  double seconds = (argc > 2) ? atof(argv[2]) : 0.1;
+
+  GFXcanvas1 c1(W, H);
+  GFXcanvas8 c8(W, H);
+  GFXcanvas16 c16(W, H);
+  Adafruit_SSD1306 oled(W, H, &Wire, -1);
+  MockTFT tft(W, H);
+  oled.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  tft.begin();
+  const Target targets[] = {
+      {"canvas1", &c1, false}, {"canvas8", &c8, true},
+      {"canvas16", &c16, true}, {"ssd1306", &oled, false},
+      {"spitft", &tft, true}};
+
+  printf("%-36s %13s %18s %17s\n", "Benchmark", "Time", "Ops", "Pixels");
+  for (const Case &c : cases) {
+    unsigned px = pixels(c);
+    for (const Target &t : targets) {
+      if (!match(filter, c.name, t.name) ||
+          (strstr(c.name, "DejaVu") && !t.color))
+        continue;
+      setUp(*t.g, c);
+      report(c.name, t.name, timeOp(*t.g, c.op, seconds), px);
+    }
+  }
+  return 0;
+}
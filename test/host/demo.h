@@ -0,0 +1,115 @@
+// The scenes of the GFX graphicstest demo, at 320x240, for the SPITFT
+// tests: demo(g, k) draws scene k of DEMO_SCENES on g, from a cleared
+// text state (classic font, size 1, cursor at the top left). g keeps its
+// own type, so shapes a class redefines over Adafruit_GFX's non-virtual
+// ones (circles on GFXtiles) go through its versions.
+
+#ifndef _HOST_DEMO_H_
+#define _HOST_DEMO_H_
+
+#include <Adafruit_GFX.h>
+
+#include "fonts/DejaVuSans9pt7b.h"
+
+#ifdef GFX_FONT_AA4
+#include "fonts/DejaVuSans9pt7bAA4.h"
+#endif
+
+#define DEMO_W 320
+#define DEMO_H 240
+
+static const char *const demoNames[] = {
+    "fillScreen", "lines", "rects", "fillRects", "fillCircles", "circles",
+    "triangles", "fillTriangles", "roundRects", "fillRoundRects", "text",
+    "text opaque", "font text", "aa text"};
+#define DEMO_SCENES (sizeof demoNames / sizeof demoNames[0])
+
+template <class G> static void demo(G &g, uint8_t k) {
+  g.setFont(NULL);
+  g.setTextSize(1);
+  g.setCursor(0, 0);
+  switch (k) {
+  case 0:
+    g.fillScreen(0x0000);
+    break;
+  case 1:
+    for (int16_t i = 0; i < DEMO_W; i += 6)
+      g.drawLine(0, 0, i, DEMO_H - 1, 0xFFE0);
+    for (int16_t i = 0; i < DEMO_H; i += 6)
+      g.drawLine(0, 0, DEMO_W - 1, i, 0x07FF);
+    break;
+  case 2:
+    for (int16_t i = 6; i < 120; i += 6)
+      g.drawRect(160 - i, 120 - i, i * 2, i * 2, 0x07E0);
+    break;
+  case 3:
+    for (int16_t i = 2; i < 120; i += 6)
+      g.fillRect(160 - i / 2, 120 - i / 2, i, i, i * 97);
+    break;
+  case 4:
+    for (int16_t x = 10; x < DEMO_W; x += 20)
+      for (int16_t y = 10; y < DEMO_H; y += 20)
+        g.fillCircle(x, y, 9, x * y);
+    break;
+  case 5:
+    for (int16_t x = 10; x < DEMO_W; x += 20)
+      for (int16_t y = 10; y < DEMO_H; y += 20)
+        g.drawCircle(x, y, 9, 0xF81F);
+    break;
+  case 6:
+    for (int16_t i = 0; i < 100; i += 5)
+      g.drawTriangle(160, 120 - i, 160 - i, 120 + i, 160 + i, 120 + i,
+                     i * 331);
+    break;
+  case 7:
+    for (int16_t i = 0; i < 100; i += 5)
+      g.fillTriangle(160, 120 - i, 160 - i, 120 + i, 160 + i, 120 + i,
+                     i * 331);
+    break;
+  case 8:
+    for (int16_t i = 6; i < 100; i += 6)
+      g.drawRoundRect(160 - i, 120 - i, i * 2, i * 2, i / 4, 0x001F);
+    break;
+  case 9:
+    for (int16_t i = 4; i < 100; i += 6)
+      g.fillRoundRect(160 - i, 120 - i, i * 2, i * 2, i / 4, i * 111);
+    break;
+  case 10:
+    g.setTextColor(0xFFFF);
+    g.println("Hello World! Transparent classic text");
+    g.setTextSize(2);
+    g.println("Size 2 text 123");
+    g.setTextSize(3);
+    g.println("3x 4.56");
+    break;
+  case 11:
+    g.setTextColor(0xFFE0, 0x001F);
+    for (uint8_t i = 0; i < 10; i++)
+      g.println("Opaque classic text, 1234567890 !?");
+    g.setTextSize(2);
+    g.println("Size 2 opaque");
+    g.setTextSize(3);
+    g.println("3x 4.56");
+    break;
+  case 12:
+    g.setFont(&DejaVuSans9pt7b);
+    g.setCursor(0, 30);
+    g.setTextColor(0xFFFF);
+    g.println("Plain GFX font 123");
+    g.println("Jumped over lazy");
+    break;
+  case 13: // Left blank in trees without anti-aliased glyphs
+#ifdef GFX_FONT_AA4
+    g.setFont(&DejaVuSans9pt7bAA4);
+    g.setCursor(0, 30);
+    g.setTextColor(0xFFFF, 0x0010);
+    g.println("AA opaque GFX font");
+    g.println("Jumped over lazy");
+    g.setTextColor(0xF800);
+    g.println("AA transparent");
+#endif
+    break;
+  }
+}
+
+#endif // _HOST_DEMO_H_
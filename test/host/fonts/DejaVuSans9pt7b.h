@@ -0,0 +1,209 @@
+const uint8_t DejaVuSans9pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xC3, 0xC0, 0xCF, 0x3C, 0xF3, 0xCC, 0x04, 0x40, 0x44,
+  0x0C, 0xC0, 0xC8, 0x7F, 0xF7, 0xFF, 0x09, 0x81, 0x90, 0xFF, 0xEF, 0xFE,
+  0x13, 0x03, 0x30, 0x32, 0x02, 0x20, 0x08, 0x04, 0x0F, 0x8F, 0xEE, 0x96,
+  0x43, 0xE0, 0xFC, 0x1F, 0x04, 0xC2, 0x71, 0x7F, 0xF3, 0xF0, 0x20, 0x10,
+  0x08, 0x00, 0x78, 0x11, 0x98, 0x43, 0x31, 0x86, 0x62, 0x0C, 0xC8, 0x19,
+  0x90, 0x1E, 0x4F, 0x01, 0x33, 0x02, 0x66, 0x08, 0xCC, 0x31, 0x98, 0x43,
+  0x31, 0x03, 0xC0, 0x0F, 0x01, 0xF8, 0x30, 0x83, 0x00, 0x38, 0x03, 0xC0,
+  0x6E, 0x6C, 0x76, 0xC3, 0xCC, 0x18, 0xE1, 0xC7, 0xFE, 0x3E, 0x70, 0xFF,
+  0xC0, 0x32, 0x66, 0x4C, 0xCC, 0xCC, 0xC4, 0x66, 0x23, 0xC4, 0x66, 0x23,
+  0x33, 0x33, 0x32, 0x66, 0x4C, 0x11, 0x25, 0x51, 0xC3, 0x8A, 0xA4, 0x88,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60,
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x6D, 0x40, 0xFF, 0xC0, 0xF0, 0x0C,
+  0x31, 0x86, 0x18, 0xE3, 0x0C, 0x31, 0xC6, 0x18, 0x63, 0x0C, 0x00, 0x3E,
+  0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xCF,
+  0xE3, 0xE0, 0x38, 0xF8, 0xD8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0xFF, 0xFF, 0x7C, 0xFE, 0x87, 0x03, 0x03, 0x07, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xFF, 0xFF, 0x7E, 0x7F, 0xA0, 0xE0, 0x30, 0x39, 0xF8, 0xFC,
+  0x07, 0x01, 0x80, 0xE0, 0xFF, 0xE7, 0xE0, 0x07, 0x01, 0xC0, 0xB0, 0x6C,
+  0x13, 0x08, 0xC6, 0x31, 0x0C, 0xFF, 0xFF, 0xF0, 0x30, 0x0C, 0x03, 0x00,
+  0x7E, 0x7E, 0x60, 0x60, 0x7C, 0x7E, 0x47, 0x03, 0x03, 0x03, 0x87, 0xFE,
+  0x7C, 0x1E, 0x1F, 0x9C, 0x5C, 0x0C, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0,
+  0xD8, 0xEF, 0xE3, 0xE0, 0xFF, 0xFF, 0x06, 0x06, 0x06, 0x0E, 0x0C, 0x0C,
+  0x1C, 0x18, 0x18, 0x38, 0x30, 0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9,
+  0xFD, 0xC7, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0, 0x3E, 0x3F, 0xB8, 0xD8,
+  0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x01, 0x81, 0xD1, 0xCF, 0xC3, 0xC0, 0xF0,
+  0x03, 0xC0, 0x6C, 0x00, 0x03, 0x6A, 0x00, 0x00, 0x20, 0x3C, 0x1F, 0x1F,
+  0x0F, 0x81, 0xF0, 0x0F, 0x80, 0x3E, 0x01, 0xE0, 0x04, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x80, 0x1E, 0x01, 0xF0, 0x07, 0xC0,
+  0x3E, 0x07, 0xC3, 0xE3, 0xE0, 0xF0, 0x10, 0x00, 0x79, 0xFE, 0x18, 0x30,
+  0x61, 0x86, 0x18, 0x30, 0x60, 0x01, 0x83, 0x00, 0x07, 0xE0, 0x1F, 0xF8,
+  0x3C, 0x1C, 0x70, 0x06, 0x60, 0x03, 0xE3, 0x63, 0xC7, 0xE3, 0xC6, 0x63,
+  0xC6, 0x66, 0xC7, 0xFC, 0xE3, 0x70, 0x60, 0x00, 0x70, 0x00, 0x38, 0x10,
+  0x1F, 0xF0, 0x07, 0xC0, 0x06, 0x00, 0x60, 0x0F, 0x00, 0xF0, 0x19, 0x81,
+  0x98, 0x19, 0x83, 0x0C, 0x3F, 0xC7, 0xFE, 0x60, 0x66, 0x06, 0xC0, 0x30,
+  0xFE, 0x7F, 0xB0, 0xD8, 0x6C, 0x37, 0xF3, 0xF9, 0x86, 0xC1, 0xE0, 0xF0,
+  0xFF, 0xEF, 0xE0, 0x0F, 0xC7, 0xFD, 0xC0, 0xB0, 0x0C, 0x01, 0x80, 0x30,
+  0x06, 0x00, 0xC0, 0x0C, 0x01, 0xC0, 0x9F, 0xF0, 0xFC, 0xFE, 0x1F, 0xF3,
+  0x07, 0x60, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x1F, 0x07,
+  0x7F, 0xCF, 0xE0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xFE, 0xFE, 0xC0,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x0F, 0xC7, 0xFD, 0xC0, 0xB0, 0x0C, 0x01,
+  0x87, 0xF0, 0xFE, 0x03, 0xC0, 0x6C, 0x0D, 0xC1, 0x9F, 0xE1, 0xF8, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x18, 0xC6, 0x31, 0x8C,
+  0x63, 0x18, 0xC6, 0x31, 0x8C, 0xFE, 0xE0, 0xC1, 0x98, 0x63, 0x18, 0x66,
+  0x0D, 0x81, 0xE0, 0x3C, 0x06, 0xC0, 0xCC, 0x18, 0xC3, 0x0C, 0x60, 0xCC,
+  0x0C, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xFF, 0xFF, 0xE0, 0x7F, 0x0F, 0xF0, 0xFD, 0x8B, 0xD9, 0xBD, 0x9B, 0xCF,
+  0x3C, 0xF3, 0xC6, 0x3C, 0x63, 0xC0, 0x3C, 0x03, 0xC0, 0x30, 0xE0, 0xF8,
+  0x3F, 0x0F, 0xC3, 0xD8, 0xF6, 0x3C, 0xCF, 0x1B, 0xC6, 0xF0, 0xFC, 0x3F,
+  0x07, 0xC1, 0xC0, 0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x06, 0xC0, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x06, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0xFC,
+  0xFE, 0xC7, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03,
+  0xC0, 0x36, 0x06, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x18, 0x00, 0xC0, 0xFC,
+  0x3F, 0x8C, 0x73, 0x0C, 0xC3, 0x31, 0xCF, 0xE3, 0xF0, 0xC6, 0x30, 0xCC,
+  0x33, 0x06, 0xC1, 0xC0, 0x3E, 0x3F, 0xB8, 0x58, 0x0C, 0x03, 0xE0, 0xFC,
+  0x07, 0x01, 0x80, 0xE0, 0xFF, 0xE7, 0xE0, 0xFF, 0xFF, 0xFF, 0x06, 0x00,
+  0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+  0x60, 0x06, 0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x3F, 0x00, 0xC0, 0x36, 0x06, 0x60,
+  0x66, 0x06, 0x30, 0xC3, 0x0C, 0x19, 0x81, 0x98, 0x19, 0x80, 0xF0, 0x0F,
+  0x00, 0x60, 0x06, 0x00, 0xC1, 0xC1, 0xE0, 0xE0, 0xD8, 0xD8, 0xCC, 0x6C,
+  0x66, 0x36, 0x33, 0x1B, 0x18, 0xD8, 0xD8, 0x6C, 0x6C, 0x36, 0x36, 0x1B,
+  0x1B, 0x07, 0x07, 0x03, 0x83, 0x81, 0xC1, 0xC0, 0x70, 0xE6, 0x18, 0xE6,
+  0x0D, 0xC0, 0xF0, 0x1C, 0x03, 0x80, 0x78, 0x1B, 0x07, 0x30, 0xC7, 0x30,
+  0x6E, 0x0E, 0xE0, 0x76, 0x06, 0x30, 0xC1, 0x98, 0x19, 0x80, 0xF0, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xFF, 0xFF,
+  0xFC, 0x07, 0x01, 0xC0, 0x30, 0x0E, 0x03, 0x80, 0xE0, 0x18, 0x06, 0x01,
+  0xC0, 0x7F, 0xFF, 0xFE, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,
+  0xC3, 0x06, 0x18, 0x61, 0xC3, 0x0C, 0x30, 0xE1, 0x86, 0x18, 0x30, 0xC0,
+  0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, 0x0E, 0x03, 0x60, 0xC6,
+  0x30, 0x6C, 0x06, 0xFF, 0xFF, 0xC0, 0xC6, 0x30, 0x3C, 0x7E, 0x47, 0x03,
+  0x3F, 0xFF, 0xC3, 0xC7, 0xFF, 0x7B, 0xC0, 0x60, 0x30, 0x18, 0x0D, 0xE7,
+  0xFB, 0x8F, 0x83, 0xC1, 0xE0, 0xF0, 0x7C, 0x7F, 0xF6, 0xF0, 0x1E, 0x7F,
+  0x61, 0xC0, 0xC0, 0xC0, 0xC0, 0x61, 0x7F, 0x1E, 0x01, 0x80, 0xC0, 0x60,
+  0x33, 0xDB, 0xFF, 0x8F, 0x83, 0xC1, 0xE0, 0xF0, 0x7C, 0x77, 0xF9, 0xEC,
+  0x1F, 0x1F, 0xE6, 0x1F, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0x81, 0x7F, 0xC7,
+  0xE0, 0x1E, 0x7C, 0xC1, 0x8F, 0xFF, 0xCC, 0x18, 0x30, 0x60, 0xC1, 0x83,
+  0x06, 0x00, 0x3D, 0xBF, 0xF8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0x7F,
+  0x9E, 0xC0, 0x68, 0x67, 0xF1, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xFE,
+  0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xF0, 0xFF, 0xFF, 0xF0,
+  0x33, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFE, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x36, 0x33, 0x31, 0xB0, 0xF0, 0x78, 0x36, 0x19, 0x8C, 0x66,
+  0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0xDE, 0x7B, 0xFB, 0xEE, 0x38, 0xF0, 0xC3,
+  0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x30, 0xDE,
+  0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x1E, 0x1F, 0xE6,
+  0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x7F, 0x87, 0x80, 0xDE, 0x7F,
+  0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0xFF, 0x6F, 0x30, 0x18, 0x0C,
+  0x06, 0x00, 0x3D, 0xBF, 0xF8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0x7F,
+  0x9E, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0xDF, 0xFE, 0x30, 0xC3, 0x0C, 0x30,
+  0xC3, 0x00, 0x7D, 0xFF, 0x0F, 0x07, 0xC3, 0xC1, 0xC3, 0xFE, 0xF8, 0x61,
+  0x86, 0x3F, 0xFD, 0x86, 0x18, 0x61, 0x86, 0x1F, 0x3C, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7F, 0x7B, 0xC0, 0xF0, 0x36, 0x19, 0x86,
+  0x33, 0x0C, 0xC3, 0x30, 0x78, 0x1E, 0x03, 0x00, 0xC7, 0x1E, 0x38, 0xF1,
+  0x46, 0xDB, 0x66, 0xDB, 0x36, 0xD9, 0xA2, 0xC7, 0x1C, 0x38, 0xE1, 0xC7,
+  0x00, 0xE1, 0xD8, 0x63, 0x30, 0xCC, 0x1E, 0x07, 0x83, 0x30, 0xCC, 0x61,
+  0xB8, 0x70, 0xC0, 0xF0, 0x36, 0x19, 0x86, 0x33, 0x0C, 0xC1, 0xE0, 0x78,
+  0x0C, 0x03, 0x00, 0xC0, 0x60, 0x78, 0x1C, 0x00, 0xFF, 0xFF, 0x06, 0x0C,
+  0x1C, 0x38, 0x30, 0x70, 0xFF, 0xFF, 0x0F, 0x1F, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0xF0, 0xF0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0F,
+  0x0F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0x7C, 0x3F, 0xFE,
+  0x1F, 0x00 };
+
+const GFXglyph DejaVuSans9pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   2,  13,   7,    3,  -12 },   // 0x21 '!'
+  {     5,   6,   5,   8,    1,  -12 },   // 0x22 '"'
+  {     9,  12,  14,  15,    1,  -13 },   // 0x23 '#'
+  {    30,   9,  17,  11,    1,  -13 },   // 0x24 '$'
+  {    50,  15,  13,  17,    1,  -12 },   // 0x25 '%'
+  {    75,  12,  13,  13,    1,  -12 },   // 0x26 '&'
+  {    95,   2,   5,   4,    1,  -12 },   // 0x27 '''
+  {    97,   4,  16,   7,    2,  -13 },   // 0x28 '('
+  {   105,   4,  16,   7,    1,  -13 },   // 0x29 ')'
+  {   113,   7,   8,   9,    1,  -12 },   // 0x2A '*'
+  {   120,  12,  12,  15,    2,  -11 },   // 0x2B '+'
+  {   138,   3,   4,   6,    1,   -1 },   // 0x2C ','
+  {   140,   5,   2,   7,    1,   -5 },   // 0x2D '-'
+  {   142,   2,   2,   6,    2,   -1 },   // 0x2E '.'
+  {   143,   6,  15,   6,    0,  -12 },   // 0x2F '/'
+  {   155,   9,  13,  11,    1,  -12 },   // 0x30 '0'
+  {   170,   8,  13,  11,    2,  -12 },   // 0x31 '1'
+  {   183,   8,  13,  11,    1,  -12 },   // 0x32 '2'
+  {   196,   9,  13,  11,    1,  -12 },   // 0x33 '3'
+  {   211,  10,  13,  11,    1,  -12 },   // 0x34 '4'
+  {   228,   8,  13,  11,    1,  -12 },   // 0x35 '5'
+  {   241,   9,  13,  11,    1,  -12 },   // 0x36 '6'
+  {   256,   8,  13,  11,    1,  -12 },   // 0x37 '7'
+  {   269,   9,  13,  11,    1,  -12 },   // 0x38 '8'
+  {   284,   9,  13,  11,    1,  -12 },   // 0x39 '9'
+  {   299,   2,   9,   6,    2,   -8 },   // 0x3A ':'
+  {   302,   3,  11,   6,    1,   -8 },   // 0x3B ';'
+  {   307,  11,  10,  15,    2,   -9 },   // 0x3C '<'
+  {   321,  11,   6,  15,    2,   -8 },   // 0x3D '='
+  {   330,  11,  10,  15,    2,   -9 },   // 0x3E '>'
+  {   344,   7,  13,  10,    1,  -12 },   // 0x3F '?'
+  {   356,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {   388,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   408,   9,  13,  12,    2,  -12 },   // 0x42 'B'
+  {   423,  11,  13,  13,    1,  -12 },   // 0x43 'C'
+  {   441,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {   459,   8,  13,  11,    2,  -12 },   // 0x45 'E'
+  {   472,   8,  13,  10,    2,  -12 },   // 0x46 'F'
+  {   485,  11,  13,  14,    1,  -12 },   // 0x47 'G'
+  {   503,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {   520,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {   524,   5,  17,   6,   -1,  -12 },   // 0x4A 'J'
+  {   535,  11,  13,  12,    2,  -12 },   // 0x4B 'K'
+  {   553,   8,  13,  10,    2,  -12 },   // 0x4C 'L'
+  {   566,  12,  13,  16,    2,  -12 },   // 0x4D 'M'
+  {   586,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {   603,  12,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   623,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {   636,  12,  15,  14,    1,  -12 },   // 0x51 'Q'
+  {   659,  10,  13,  13,    2,  -12 },   // 0x52 'R'
+  {   676,   9,  13,  11,    1,  -12 },   // 0x53 'S'
+  {   691,  12,  13,  12,    0,  -12 },   // 0x54 'T'
+  {   711,  10,  13,  14,    2,  -12 },   // 0x55 'U'
+  {   728,  12,  13,  12,    0,  -12 },   // 0x56 'V'
+  {   748,  17,  13,  19,    1,  -12 },   // 0x57 'W'
+  {   776,  11,  13,  13,    1,  -12 },   // 0x58 'X'
+  {   794,  12,  13,  12,    0,  -12 },   // 0x59 'Y'
+  {   814,  11,  13,  13,    1,  -12 },   // 0x5A 'Z'
+  {   832,   4,  16,   7,    1,  -13 },   // 0x5B '['
+  {   840,   6,  15,   6,    0,  -12 },   // 0x5C '\'
+  {   852,   4,  16,   7,    2,  -13 },   // 0x5D ']'
+  {   860,  11,   5,  15,    2,  -12 },   // 0x5E '^'
+  {   867,   9,   2,   9,    0,    3 },   // 0x5F '_'
+  {   870,   4,   3,   9,    2,  -13 },   // 0x60 '`'
+  {   872,   8,  10,  10,    1,   -9 },   // 0x61 'a'
+  {   882,   9,  14,  11,    2,  -13 },   // 0x62 'b'
+  {   898,   8,  10,   9,    1,   -9 },   // 0x63 'c'
+  {   908,   9,  14,  11,    1,  -13 },   // 0x64 'd'
+  {   924,  10,  10,  11,    1,   -9 },   // 0x65 'e'
+  {   937,   7,  14,   6,    0,  -13 },   // 0x66 'f'
+  {   950,   9,  14,  11,    1,   -9 },   // 0x67 'g'
+  {   966,   8,  14,  11,    2,  -13 },   // 0x68 'h'
+  {   980,   2,  14,   5,    2,  -13 },   // 0x69 'i'
+  {   984,   4,  18,   5,    0,  -13 },   // 0x6A 'j'
+  {   993,   9,  14,  10,    2,  -13 },   // 0x6B 'k'
+  {  1009,   2,  14,   5,    2,  -13 },   // 0x6C 'l'
+  {  1013,  14,  10,  17,    2,   -9 },   // 0x6D 'm'
+  {  1031,   8,  10,  11,    2,   -9 },   // 0x6E 'n'
+  {  1041,  10,  10,  11,    1,   -9 },   // 0x6F 'o'
+  {  1054,   9,  14,  11,    2,   -9 },   // 0x70 'p'
+  {  1070,   9,  14,  11,    1,   -9 },   // 0x71 'q'
+  {  1086,   6,  10,   8,    2,   -9 },   // 0x72 'r'
+  {  1094,   7,  10,   8,    1,   -9 },   // 0x73 's'
+  {  1103,   6,  13,   7,    1,  -12 },   // 0x74 't'
+  {  1113,   8,  10,  11,    2,   -9 },   // 0x75 'u'
+  {  1123,  10,  10,  11,    1,   -9 },   // 0x76 'v'
+  {  1136,  13,  10,  16,    2,   -9 },   // 0x77 'w'
+  {  1153,  10,  10,  11,    1,   -9 },   // 0x78 'x'
+  {  1166,  10,  14,  11,    1,   -9 },   // 0x79 'y'
+  {  1184,   8,  10,   9,    1,   -9 },   // 0x7A 'z'
+  {  1194,   8,  17,  11,    2,  -13 },   // 0x7B '{'
+  {  1211,   2,  18,   6,    2,  -13 },   // 0x7C '|'
+  {  1216,   8,  17,  11,    2,  -13 },   // 0x7D '}'
+  {  1233,  11,   3,  15,    2,   -7 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans9pt7b PROGMEM = {
+  (uint8_t  *)DejaVuSans9pt7bBitmaps,
+  (GFXglyph *)DejaVuSans9pt7bGlyphs,
+  0x20, 0x7E, 21 };
+
+// Approx. 1914 bytes
@@ -0,0 +1,311 @@
+const uint8_t DejaVuSans9pt7bAA2Bitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF0, 0xF0, 0x00, 0x74, 0x70, 0x00, 0x70, 0xB0, 0x00, 0xA0, 0xA0,
+  0x00, 0xA0, 0xD0, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x01, 0xC2, 0x80,
+  0x02, 0x83, 0x40, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x07, 0x0B, 0x00,
+  0x0A, 0x0A, 0x00, 0x0E, 0x0D, 0x00, 0x0D, 0x1D, 0x00, 0x00, 0xC0, 0x00,
+  0x0C, 0x00, 0x1B, 0xF9, 0x07, 0xFF, 0xF0, 0xF8, 0xC6, 0x0F, 0x0C, 0x00,
+  0xBE, 0xC0, 0x02, 0xFF, 0xD0, 0x05, 0xFF, 0x40, 0x0C, 0x7C, 0x00, 0xC3,
+  0xC9, 0x0C, 0xBC, 0xFF, 0xFF, 0x46, 0xBF, 0x90, 0x00, 0xC0, 0x00, 0x0C,
+  0x00, 0x00, 0xC0, 0x00, 0x2F, 0x80, 0x07, 0x01, 0xD7, 0x40, 0x34, 0x0F,
+  0x0F, 0x02, 0x80, 0x3C, 0x3C, 0x1C, 0x00, 0xF0, 0xF0, 0x90, 0x02, 0xD7,
+  0x46, 0x00, 0x02, 0xF8, 0x30, 0xBE, 0x00, 0x02, 0x47, 0x5D, 0x00, 0x18,
+  0x3C, 0x3C, 0x00, 0xD0, 0xF0, 0xF0, 0x0A, 0x03, 0xC3, 0xC0, 0x70, 0x07,
+  0x5D, 0x03, 0x40, 0x0B, 0xE0, 0x01, 0xBE, 0x40, 0x07, 0xFF, 0xC0, 0x0F,
+  0x41, 0x80, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x2E,
+  0xF8, 0x3C, 0xB4, 0x7E, 0x78, 0xF0, 0x1F, 0xF0, 0xF4, 0x07, 0xD0, 0xBD,
+  0x07, 0xE0, 0x3F, 0xFE, 0xF8, 0x0B, 0xF8, 0x7E, 0xFF, 0xFF, 0xF0, 0x0A,
+  0x0D, 0x2C, 0x38, 0x74, 0xB4, 0xF0, 0xF0, 0xF0, 0xF0, 0xB4, 0x74, 0x38,
+  0x2C, 0x0D, 0x0A, 0xA0, 0x70, 0x38, 0x2C, 0x1D, 0x1E, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x1E, 0x1D, 0x2C, 0x38, 0x70, 0xA0, 0x03, 0x02, 0x4C, 0x67, 0x77,
+  0x42, 0xE0, 0x0B, 0x81, 0xDD, 0xD9, 0x31, 0x80, 0xC0, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0xF7, 0x64,
+  0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xF0, 0x1E, 0x02, 0xD0, 0x3C, 0x07, 0x80,
+  0xB8, 0x0B, 0x40, 0xF0, 0x1E, 0x02, 0xE0, 0x2D, 0x03, 0xC0, 0x78, 0x0B,
+  0x40, 0xF4, 0x00, 0x0B, 0xF8, 0x0B, 0xFF, 0x87, 0xD1, 0xF6, 0xD0, 0x1E,
+  0xF4, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x07, 0xED,
+  0x01, 0xE7, 0xD1, 0xF4, 0xBF, 0xF8, 0x0B, 0xF8, 0x00, 0x1B, 0xC0, 0xFF,
+  0xC0, 0xE3, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B,
+  0xE4, 0x3F, 0xFF, 0x49, 0x06, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x0B,
+  0x40, 0x07, 0xC0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x03,
+  0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x6B, 0xF9, 0x3F, 0xFF, 0xD9, 0x41, 0xBC,
+  0x00, 0x0F, 0x00, 0x1B, 0x83, 0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x6E, 0x00,
+  0x03, 0xC0, 0x00, 0xF9, 0x01, 0xBB, 0xFF, 0xFC, 0x6F, 0xE8, 0x00, 0x00,
+  0x2F, 0x00, 0x07, 0xF0, 0x00, 0xDF, 0x00, 0x28, 0xF0, 0x07, 0x4F, 0x00,
+  0xD0, 0xF0, 0x28, 0x0F, 0x07, 0x40, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x3F, 0xFC, 0x3F, 0xFC,
+  0x3C, 0x00, 0x3C, 0x00, 0x3F, 0xE4, 0x3F, 0xFD, 0x24, 0x7E, 0x00, 0x1F,
+  0x00, 0x0F, 0x00, 0x1F, 0x90, 0x7E, 0xFF, 0xFC, 0x6F, 0xE0, 0x06, 0xF9,
+  0x07, 0xFF, 0xC3, 0xE4, 0x62, 0xF0, 0x00, 0xB4, 0x00, 0x3D, 0xBE, 0x4F,
+  0xBF, 0xF7, 0xE4, 0x6E, 0xF0, 0x03, 0xEC, 0x00, 0xF7, 0x80, 0xB8, 0xBF,
+  0xFD, 0x07, 0xF9, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2D, 0x00, 0x3C,
+  0x00, 0x78, 0x00, 0xB8, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0,
+  0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x1B, 0xF9, 0x1F, 0xFF, 0xDF, 0x80,
+  0xBF, 0xC0, 0x0F, 0xB8, 0x0B, 0x87, 0xFF, 0x42, 0xFF, 0xE2, 0xE0, 0x6E,
+  0xF0, 0x03, 0xFC, 0x00, 0xFB, 0x80, 0xB9, 0xFF, 0xFD, 0x1B, 0xF9, 0x00,
+  0x1B, 0xF4, 0x1F, 0xFF, 0x8B, 0x91, 0xB7, 0xC0, 0x0E, 0xF0, 0x03, 0xEE,
+  0x02, 0xF7, 0xFF, 0xBC, 0x6F, 0x9F, 0x00, 0x07, 0x80, 0x03, 0xE2, 0x42,
+  0xF0, 0xFF, 0xF4, 0x1B, 0xE4, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x3C,
+  0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3D, 0xD9, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x1B, 0xF0, 0x07, 0xFE, 0x46, 0xFF, 0x40, 0xFF, 0x90, 0x03, 0xFE, 0x40,
+  0x01, 0xBF, 0xD0, 0x00, 0x1F, 0xF9, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x60,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x90, 0x00, 0x03, 0xF9, 0x00, 0x06, 0xFF,
+  0x40, 0x00, 0x7F, 0xE4, 0x00, 0x1B, 0xFC, 0x00, 0x6F, 0xF0, 0x1F, 0xF9,
+  0x1B, 0xFD, 0x00, 0xFE, 0x40, 0x02, 0x40, 0x00, 0x00, 0x6F, 0x93, 0xFF,
+  0xD9, 0x0B, 0xC0, 0x0F, 0x00, 0x78, 0x03, 0x80, 0x3C, 0x02, 0xD0, 0x0F,
+  0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x2B, 0xF9, 0x00,
+  0x02, 0xFF, 0xFF, 0xD0, 0x0B, 0xE4, 0x06, 0xF4, 0x2F, 0x40, 0x00, 0x7D,
+  0x7D, 0x00, 0x00, 0x2E, 0xB8, 0x0B, 0x7C, 0x0F, 0xF4, 0x2F, 0xBC, 0x0F,
+  0xF0, 0x3D, 0x7C, 0x1E, 0xF0, 0x3D, 0x7C, 0x7D, 0xF4, 0x2F, 0xBF, 0xF4,
+  0xB8, 0x0B, 0x7E, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+  0x0F, 0xE4, 0x1B, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xE4, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xEB, 0x40,
+  0x02, 0xD7, 0x80, 0x03, 0xC3, 0xC0, 0x07, 0x82, 0xD0, 0x0B, 0x40, 0xE0,
+  0x1F, 0xFF, 0xF4, 0x2F, 0xFF, 0xF8, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x2D,
+  0xB4, 0x00, 0x1E, 0xFF, 0xE4, 0x3F, 0xFF, 0x8F, 0x01, 0xF3, 0xC0, 0x3C,
+  0xF0, 0x1E, 0x3F, 0xFE, 0x0F, 0xFF, 0xD3, 0xC0, 0x6D, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x01, 0xBB, 0xFF, 0xFD, 0xFF, 0xF9, 0x00, 0x01, 0xBF, 0xA4,
+  0x2F, 0xFF, 0xF2, 0xF4, 0x05, 0x9F, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0,
+  0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x00,
+  0x02, 0xF4, 0x05, 0x82, 0xFF, 0xFF, 0x01, 0xBF, 0xA4, 0xFF, 0xF9, 0x03,
+  0xFF, 0xFF, 0x4F, 0x00, 0x7F, 0x3C, 0x00, 0x2D, 0xF0, 0x00, 0x7B, 0xC0,
+  0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x7B, 0xC0, 0x02,
+  0xDF, 0x00, 0x7F, 0x3F, 0xFF, 0xF4, 0xFF, 0xF9, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFC, 0xFF,
+  0xFC, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0x01, 0xBF, 0xA4, 0x3F, 0xFF, 0xF3, 0xF4, 0x05, 0x9F, 0x00, 0x00,
+  0xB4, 0x00, 0x03, 0xC0, 0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xB4,
+  0x00, 0x3D, 0xE0, 0x00, 0xF3, 0xE4, 0x07, 0xC7, 0xFF, 0xFD, 0x01, 0xBF,
+  0x80, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF0, 0xBB,
+  0xFD, 0xF9, 0x00, 0xF0, 0x03, 0xD3, 0xC0, 0x3D, 0x0F, 0x03, 0xD0, 0x3C,
+  0x7D, 0x00, 0xF7, 0xD0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3D, 0xF4,
+  0x00, 0xF1, 0xF4, 0x03, 0xC1, 0xF4, 0x0F, 0x01, 0xF4, 0x3C, 0x01, 0xF4,
+  0xF0, 0x01, 0xF4, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0xBF, 0xFB,
+  0x00, 0xEF, 0xF7, 0x81, 0xDF, 0xF3, 0xC2, 0xCF, 0xF2, 0xD7, 0x8F, 0xF0,
+  0xEB, 0x0F, 0xF0, 0xBE, 0x0F, 0xF0, 0x7D, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0,
+  0x0F, 0xFE, 0x00, 0xFF, 0xB4, 0x0F, 0xF3, 0xC0, 0xFF, 0x2D, 0x0F, 0xF0,
+  0xF0, 0xFF, 0x07, 0x8F, 0xF0, 0x2D, 0xFF, 0x01, 0xFF, 0xF0, 0x0B, 0xFF,
+  0x00, 0x3F, 0xF0, 0x02, 0xF0, 0x02, 0xBE, 0x80, 0x0F, 0xFF, 0xF0, 0x3E,
+  0x41, 0xBC, 0x7C, 0x00, 0x3D, 0xB4, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xB4, 0x00, 0x1E, 0x7C, 0x00, 0x3D, 0x3E,
+  0x41, 0xBC, 0x0F, 0xFF, 0xF0, 0x02, 0xBE, 0x80, 0xFF, 0xE4, 0xFF, 0xFD,
+  0xF0, 0x2E, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x2E, 0xFF, 0xFD, 0xFF, 0xE4,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x02, 0xBE,
+  0x80, 0x0F, 0xFF, 0xF4, 0x3E, 0x41, 0xBC, 0x7C, 0x00, 0x3D, 0xB4, 0x00,
+  0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xB4, 0x00,
+  0x1E, 0x7C, 0x00, 0x3D, 0x3E, 0x41, 0xB8, 0x1F, 0xFF, 0xE0, 0x02, 0xBF,
+  0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0xFF, 0xE4, 0x0F, 0xFF, 0xD0,
+  0xF0, 0x2E, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x02, 0xE0, 0xFF, 0xF8,
+  0x0F, 0xFF, 0x40, 0xF0, 0x7D, 0x0F, 0x01, 0xE0, 0xF0, 0x0F, 0x4F, 0x00,
+  0x7C, 0xF0, 0x02, 0xE0, 0x1B, 0xF9, 0x07, 0xFF, 0xF0, 0xB9, 0x06, 0x0F,
+  0x00, 0x00, 0xF4, 0x00, 0x07, 0xFE, 0x40, 0x1B, 0xFE, 0x00, 0x01, 0xF8,
+  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x94, 0x1B, 0xCF, 0xFF, 0xF4, 0x6B, 0xF9,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFB, 0x40, 0x1E, 0x7D, 0x07, 0xD2, 0xFF, 0xF8, 0x06, 0xF9,
+  0x00, 0xB4, 0x00, 0x1E, 0x78, 0x00, 0x2D, 0x3C, 0x00, 0x3C, 0x2D, 0x00,
+  0x78, 0x1F, 0x00, 0xF4, 0x0B, 0x41, 0xF0, 0x07, 0x82, 0xD0, 0x03, 0xC3,
+  0xC0, 0x02, 0xD7, 0x80, 0x01, 0xEB, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x7D,
+  0x00, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xF0, 0x07, 0xED, 0x01, 0xFD, 0x01,
+  0xE7, 0x80, 0xBB, 0x80, 0xB4, 0xF0, 0x3C, 0xF0, 0x3C, 0x3D, 0x1E, 0x2C,
+  0x1E, 0x0B, 0x47, 0x8B, 0x47, 0x81, 0xE2, 0xD1, 0xE2, 0xD0, 0x3C, 0xF0,
+  0x3C, 0xF0, 0x0B, 0x78, 0x0B, 0x78, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0x7F,
+  0x40, 0x7F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xE0, 0x02, 0xE0, 0x00,
+  0x2E, 0x00, 0xB8, 0x3D, 0x07, 0xC0, 0xBC, 0x3D, 0x00, 0xF6, 0xE0, 0x01,
+  0xFF, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x80, 0x03, 0xDF,
+  0x40, 0x2E, 0x1F, 0x01, 0xF0, 0x2E, 0x0F, 0x40, 0x7C, 0xB8, 0x00, 0xB8,
+  0xB8, 0x00, 0x2E, 0x3D, 0x00, 0x7C, 0x1F, 0x00, 0xF4, 0x07, 0x82, 0xD0,
+  0x02, 0xD7, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0x00,
+  0x02, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xBC,
+  0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xF4, 0x0B, 0x40, 0x78, 0x03,
+  0xC0, 0x2D, 0x02, 0xE0, 0x1E, 0x00, 0xF0, 0x0B, 0x40, 0xB8, 0x07, 0x80,
+  0x3C, 0x02, 0xD0, 0x1E, 0x01, 0xF0, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xFF, 0x00, 0xB8,
+  0x00, 0x0B, 0xB8, 0x00, 0xB4, 0x78, 0x0B, 0x40, 0x78, 0xB4, 0x00, 0x78,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xB0, 0x28, 0x0A, 0x1B, 0xE4, 0x3F, 0xFD,
+  0x24, 0x2E, 0x00, 0x0F, 0x1B, 0xFF, 0xBF, 0xFF, 0xF4, 0x0F, 0xF4, 0x2F,
+  0xBF, 0xEF, 0x2F, 0x8F, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF2, 0xF8, 0x3E, 0xFF, 0xCF, 0xD1, 0xFB, 0xD0, 0x1F, 0xF0, 0x03,
+  0xFC, 0x00, 0xFF, 0x40, 0x7F, 0xF4, 0x7E, 0xFB, 0xFF, 0x3C, 0xBE, 0x00,
+  0x06, 0xF9, 0x2F, 0xFF, 0x7D, 0x06, 0xB4, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xB4, 0x00, 0x7D, 0x06, 0x2F, 0xFF, 0x06, 0xF9, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x0B, 0xE3, 0xCF, 0xFE, 0xFB, 0xD1, 0xFF,
+  0xD0, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x7E, 0xF4, 0x7F, 0x3F,
+  0xFB, 0xC2, 0xF8, 0xF0, 0x06, 0xFE, 0x02, 0xFF, 0xF8, 0x7D, 0x06, 0xEB,
+  0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x07, 0xD0, 0x16,
+  0x2F, 0xFF, 0xF0, 0x6F, 0xE9, 0x02, 0xFC, 0x2F, 0xF0, 0xF4, 0x03, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x0B, 0xE3, 0xCF, 0xFE, 0xFB, 0xD1,
+  0xFF, 0xD0, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x7E, 0xF4, 0x7F,
+  0x3F, 0xFB, 0xC2, 0xF8, 0xF0, 0x00, 0x78, 0x90, 0x7D, 0x3F, 0xFE, 0x06,
+  0xFE, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF2, 0xF8,
+  0xFB, 0xFD, 0xF9, 0x2E, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0xFD, 0xF4, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x1F, 0x7C, 0x1F, 0x4F, 0x1F, 0x43, 0xDF,
+  0x40, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0x7D, 0x03, 0xC7, 0xD0, 0xF0, 0x7D,
+  0x3C, 0x07, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xF4,
+  0x2F, 0x8F, 0xBF, 0xDB, 0xFD, 0xF9, 0x2F, 0x92, 0xEF, 0x40, 0xF4, 0x0F,
+  0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0x00, 0xFF, 0x00,
+  0xF0, 0x0F, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xF2, 0xF8, 0xFB,
+  0xFD, 0xF9, 0x2E, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0x06, 0xF9, 0x02, 0xFF, 0xF8, 0x7D, 0x07,
+  0xDB, 0x40, 0x1E, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xB4, 0x01, 0xE7, 0xD0,
+  0x7D, 0x2F, 0xFF, 0x80, 0x6F, 0x90, 0xF2, 0xF8, 0x3E, 0xFF, 0xCF, 0xD1,
+  0xFB, 0xD0, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x7F, 0xF4, 0x7E,
+  0xFB, 0xFF, 0x3C, 0xBE, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x00, 0x0B, 0xE3, 0xCF, 0xFE, 0xFB, 0xD1, 0xFF, 0xD0, 0x1F, 0xF0,
+  0x03, 0xFC, 0x00, 0xFF, 0x40, 0x7E, 0xF4, 0x7F, 0x3F, 0xFB, 0xC2, 0xF8,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0xF2, 0xFF,
+  0xBF, 0xFD, 0x0F, 0x40, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0x2F, 0xE4, 0xBF, 0xFC, 0xF4, 0x18, 0xF9, 0x40, 0x7F, 0xF4, 0x06,
+  0xF8, 0x00, 0x3C, 0x90, 0x7C, 0xFF, 0xF8, 0x6F, 0xD0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x0F, 0xFF, 0xFF, 0xF3, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3D, 0x02, 0xFF, 0x0B, 0xF0, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xB8, 0x6F, 0x7F, 0xEF, 0x2F,
+  0x8F, 0x3C, 0x00, 0x3C, 0x2D, 0x00, 0x78, 0x1E, 0x00, 0xB0, 0x0F, 0x01,
+  0xE0, 0x07, 0x82, 0xD0, 0x03, 0xC3, 0xC0, 0x02, 0xD7, 0x80, 0x01, 0xEB,
+  0x40, 0x00, 0xFF, 0x00, 0x00, 0x7D, 0x00, 0x3C, 0x0B, 0x80, 0xF0, 0xB4,
+  0x3F, 0x07, 0x82, 0xD1, 0xFD, 0x1E, 0x07, 0x8B, 0x78, 0xB4, 0x0F, 0x2C,
+  0xE3, 0xC0, 0x2C, 0xE2, 0xCE, 0x00, 0xBB, 0x47, 0xB8, 0x01, 0xFC, 0x0F,
+  0xD0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0xB8, 0x02, 0xE3,
+  0xD0, 0x7C, 0x1F, 0x0F, 0x40, 0xB5, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0xC0,
+  0x0B, 0x5E, 0x01, 0xE0, 0xF4, 0x3D, 0x07, 0xCB, 0x80, 0x2E, 0x3C, 0x00,
+  0x3C, 0x2D, 0x00, 0x78, 0x1F, 0x00, 0xF4, 0x0B, 0x41, 0xE0, 0x07, 0x82,
+  0xD0, 0x02, 0xD7, 0xC0, 0x01, 0xEB, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x7D,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB0, 0x00, 0x0F, 0xE0,
+  0x00, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7D, 0x00, 0xF4,
+  0x02, 0xE0, 0x0B, 0xC0, 0x1F, 0x40, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0xBF, 0x02, 0xFF, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x0B, 0x80, 0xFE, 0x40, 0xFE, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x07,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x02, 0xE0, 0x01, 0xBF, 0x00,
+  0xBF, 0x02, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07,
+  0xC0, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x90, 0x7F, 0xFF,
+  0xFF, 0xF4, 0x1A, 0xF8, 0x00, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans9pt7bAA2Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   2,  13,   7,    3,  -12 },   // 0x21 '!'
+  {     7,   6,   5,   8,    1,  -12 },   // 0x22 '"'
+  {    15,  12,  14,  15,    1,  -13 },   // 0x23 '#'
+  {    57,  10,  17,  11,    1,  -13 },   // 0x24 '$'
+  {   100,  15,  13,  17,    1,  -12 },   // 0x25 '%'
+  {   149,  12,  13,  13,    1,  -12 },   // 0x26 '&'
+  {   188,   2,   5,   4,    1,  -12 },   // 0x27 '''
+  {   191,   4,  16,   7,    2,  -13 },   // 0x28 '('
+  {   207,   4,  16,   7,    1,  -13 },   // 0x29 ')'
+  {   223,   7,   8,   9,    1,  -12 },   // 0x2A '*'
+  {   237,  12,  12,  15,    2,  -11 },   // 0x2B '+'
+  {   273,   3,   4,   6,    1,   -1 },   // 0x2C ','
+  {   276,   5,   2,   7,    1,   -5 },   // 0x2D '-'
+  {   279,   2,   2,   6,    2,   -1 },   // 0x2E '.'
+  {   280,   6,  15,   6,    0,  -12 },   // 0x2F '/'
+  {   303,   9,  13,  11,    1,  -12 },   // 0x30 '0'
+  {   333,   8,  13,  11,    2,  -12 },   // 0x31 '1'
+  {   359,   9,  13,  11,    1,  -12 },   // 0x32 '2'
+  {   389,   9,  13,  11,    1,  -12 },   // 0x33 '3'
+  {   419,  10,  13,  11,    1,  -12 },   // 0x34 '4'
+  {   452,   8,  13,  11,    1,  -12 },   // 0x35 '5'
+  {   478,   9,  13,  11,    1,  -12 },   // 0x36 '6'
+  {   508,   8,  13,  11,    1,  -12 },   // 0x37 '7'
+  {   534,   9,  13,  11,    1,  -12 },   // 0x38 '8'
+  {   564,   9,  13,  11,    1,  -12 },   // 0x39 '9'
+  {   594,   2,   9,   6,    2,   -8 },   // 0x3A ':'
+  {   599,   3,  11,   6,    1,   -8 },   // 0x3B ';'
+  {   608,  11,  10,  15,    2,   -9 },   // 0x3C '<'
+  {   636,  11,   6,  15,    2,   -8 },   // 0x3D '='
+  {   653,  11,  10,  15,    2,   -9 },   // 0x3E '>'
+  {   681,   7,  13,  10,    1,  -12 },   // 0x3F '?'
+  {   704,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {   768,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   807,   9,  13,  12,    2,  -12 },   // 0x42 'B'
+  {   837,  11,  13,  13,    1,  -12 },   // 0x43 'C'
+  {   873,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {   909,   8,  13,  11,    2,  -12 },   // 0x45 'E'
+  {   935,   8,  13,  10,    2,  -12 },   // 0x46 'F'
+  {   961,  11,  13,  14,    1,  -12 },   // 0x47 'G'
+  {   997,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {  1030,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {  1037,   5,  17,   6,   -1,  -12 },   // 0x4A 'J'
+  {  1059,  11,  13,  12,    2,  -12 },   // 0x4B 'K'
+  {  1095,   8,  13,  10,    2,  -12 },   // 0x4C 'L'
+  {  1121,  12,  13,  16,    2,  -12 },   // 0x4D 'M'
+  {  1160,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {  1193,  12,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {  1232,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {  1258,  12,  15,  14,    1,  -12 },   // 0x51 'Q'
+  {  1303,  10,  13,  13,    2,  -12 },   // 0x52 'R'
+  {  1336,  10,  13,  11,    1,  -12 },   // 0x53 'S'
+  {  1369,  12,  13,  12,    0,  -12 },   // 0x54 'T'
+  {  1408,  10,  13,  14,    2,  -12 },   // 0x55 'U'
+  {  1441,  12,  13,  12,    0,  -12 },   // 0x56 'V'
+  {  1480,  17,  13,  19,    1,  -12 },   // 0x57 'W'
+  {  1536,  11,  13,  13,    1,  -12 },   // 0x58 'X'
+  {  1572,  12,  13,  12,    0,  -12 },   // 0x59 'Y'
+  {  1611,  11,  13,  13,    1,  -12 },   // 0x5A 'Z'
+  {  1647,   4,  16,   7,    1,  -13 },   // 0x5B '['
+  {  1663,   6,  15,   6,    0,  -12 },   // 0x5C '\'
+  {  1686,   4,  16,   7,    2,  -13 },   // 0x5D ']'
+  {  1702,  11,   5,  15,    2,  -12 },   // 0x5E '^'
+  {  1716,   9,   2,   9,    0,    3 },   // 0x5F '_'
+  {  1721,   4,   3,   9,    2,  -13 },   // 0x60 '`'
+  {  1724,   8,  10,  10,    1,   -9 },   // 0x61 'a'
+  {  1744,   9,  14,  11,    2,  -13 },   // 0x62 'b'
+  {  1776,   8,  10,   9,    1,   -9 },   // 0x63 'c'
+  {  1796,   9,  14,  11,    1,  -13 },   // 0x64 'd'
+  {  1828,  10,  10,  11,    1,   -9 },   // 0x65 'e'
+  {  1853,   7,  14,   6,    0,  -13 },   // 0x66 'f'
+  {  1878,   9,  14,  11,    1,   -9 },   // 0x67 'g'
+  {  1910,   8,  14,  11,    2,  -13 },   // 0x68 'h'
+  {  1938,   2,  14,   5,    2,  -13 },   // 0x69 'i'
+  {  1945,   4,  18,   5,    0,  -13 },   // 0x6A 'j'
+  {  1963,   9,  14,  10,    2,  -13 },   // 0x6B 'k'
+  {  1995,   2,  14,   5,    2,  -13 },   // 0x6C 'l'
+  {  2002,  14,  10,  17,    2,   -9 },   // 0x6D 'm'
+  {  2037,   8,  10,  11,    2,   -9 },   // 0x6E 'n'
+  {  2057,  10,  10,  11,    1,   -9 },   // 0x6F 'o'
+  {  2082,   9,  14,  11,    2,   -9 },   // 0x70 'p'
+  {  2114,   9,  14,  11,    1,   -9 },   // 0x71 'q'
+  {  2146,   6,  10,   8,    2,   -9 },   // 0x72 'r'
+  {  2161,   8,  10,   8,    1,   -9 },   // 0x73 's'
+  {  2181,   6,  13,   7,    1,  -12 },   // 0x74 't'
+  {  2201,   8,  10,  11,    2,   -9 },   // 0x75 'u'
+  {  2221,  12,  10,  11,    0,   -9 },   // 0x76 'v'
+  {  2251,  15,  10,  16,    1,   -9 },   // 0x77 'w'
+  {  2289,  10,  10,  11,    1,   -9 },   // 0x78 'x'
+  {  2314,  12,  14,  11,    0,   -9 },   // 0x79 'y'
+  {  2356,   8,  10,   9,    1,   -9 },   // 0x7A 'z'
+  {  2376,   8,  17,  11,    2,  -13 },   // 0x7B '{'
+  {  2410,   2,  18,   6,    2,  -13 },   // 0x7C '|'
+  {  2419,   8,  17,  11,    2,  -13 },   // 0x7D '}'
+  {  2453,  11,   5,  15,    2,   -8 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans9pt7bAA2 PROGMEM = {
+  (uint8_t  *)DejaVuSans9pt7bAA2Bitmaps,
+  (GFXglyph *)DejaVuSans9pt7bAA2Glyphs,
+  0x20, 0x7E, 21, GFX_FONT_AA2 };
+
+// Approx. 3143 bytes
@@ -0,0 +1,513 @@
+const uint8_t DejaVuSans9pt7bAA4Bitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xDD, 0xCC, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x30, 0x4F, 0x10, 0x00, 0x00,
+  0x6F, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x9C, 0x00, 0xBA, 0x00, 0x00, 0x00,
+  0xC8, 0x00, 0xE7, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x09, 0xC0, 0x00, 0x00, 0x0C,
+  0x90, 0x0E, 0x70, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x6E, 0x00, 0x8D, 0x00, 0x00, 0x00, 0xAB,
+  0x00, 0xB9, 0x00, 0x00, 0x00, 0xD8, 0x00, 0xE6, 0x00, 0x00, 0x01, 0xF4,
+  0x03, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x04, 0xBE, 0xFE, 0xA4, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x00,
+  0xDF, 0x91, 0xF1, 0x5B, 0x00, 0xEF, 0x10, 0xF0, 0x00, 0x00, 0xBF, 0xD8,
+  0xF2, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x47, 0xFD, 0xFF,
+  0x60, 0x00, 0x00, 0xF0, 0x6F, 0xD0, 0x00, 0x00, 0xF0, 0x1F, 0xF0, 0xC6,
+  0x10, 0xF2, 0x9F, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x38, 0xCE, 0xFD,
+  0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xF0, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x00, 0x00, 0x5D, 0x00,
+  0x07, 0xF6, 0x6F, 0x70, 0x00, 0x1D, 0x40, 0x00, 0xDF, 0x11, 0xFD, 0x00,
+  0x09, 0x90, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x03, 0xD1, 0x00, 0x00, 0xDF,
+  0x11, 0xFD, 0x00, 0xC5, 0x00, 0x00, 0x08, 0xF6, 0x6F, 0x70, 0x7B, 0x00,
+  0x00, 0x00, 0x08, 0xEE, 0x80, 0x2E, 0x20, 0x8E, 0xE8, 0x00, 0x00, 0x00,
+  0x0B, 0x70, 0x7F, 0x66, 0xF7, 0x00, 0x00, 0x05, 0xC0, 0x0D, 0xF1, 0x1F,
+  0xD0, 0x00, 0x01, 0xD3, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x99, 0x00,
+  0x0D, 0xF1, 0x1F, 0xD0, 0x00, 0x4D, 0x10, 0x00, 0x7F, 0x66, 0xF7, 0x00,
+  0x0D, 0x50, 0x00, 0x00, 0x8E, 0xE8, 0x00, 0x00, 0x04, 0xCF, 0xDA, 0x40,
+  0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xDF, 0x71, 0x14, 0xB0,
+  0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0x1B, 0xE8, 0xFF, 0x90, 0x2F,
+  0xD0, 0x8F, 0x50, 0x5F, 0xF9, 0x5F, 0x90, 0xEF, 0x10, 0x04, 0xEF, 0xEE,
+  0x20, 0xEF, 0x50, 0x00, 0x6F, 0xF5, 0x00, 0xAF, 0xE5, 0x11, 0x7F, 0xF9,
+  0x00, 0x2D, 0xFF, 0xFF, 0xFC, 0xFF, 0x80, 0x01, 0x8D, 0xFE, 0x90, 0x5E,
+  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x8C, 0x02, 0xF5, 0x0A, 0xE0,
+  0x1F, 0xA0, 0x6F, 0x60, 0xAF, 0x30, 0xDF, 0x10, 0xEF, 0x00, 0xEF, 0x00,
+  0xDF, 0x10, 0xAF, 0x30, 0x6F, 0x60, 0x1F, 0xA0, 0x0A, 0xE0, 0x02, 0xF5,
+  0x00, 0x8C, 0xC8, 0x00, 0x5F, 0x20, 0x0E, 0x90, 0x0A, 0xF1, 0x06, 0xF6,
+  0x03, 0xFA, 0x01, 0xFD, 0x00, 0xFE, 0x01, 0xFE, 0x01, 0xFD, 0x03, 0xFA,
+  0x06, 0xF6, 0x0A, 0xF1, 0x0E, 0x90, 0x5F, 0x20, 0xC8, 0x00, 0x00, 0x0F,
+  0x00, 0x0A, 0x30, 0xF0, 0x3A, 0x6E, 0x5F, 0x5E, 0x60, 0x2C, 0xFC, 0x20,
+  0x02, 0xCF, 0xC2, 0x05, 0xE5, 0xF5, 0xE5, 0xA3, 0x0F, 0x03, 0xA0, 0x00,
+  0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x0F, 0xF1, 0xFD, 0x6E, 0x3C, 0x60, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xF9, 0x00, 0x0B, 0xF5,
+  0x00, 0x0E, 0xF1, 0x00, 0x4F, 0xC0, 0x00, 0x8F, 0x80, 0x00, 0xCF, 0x50,
+  0x01, 0xFF, 0x10, 0x04, 0xFC, 0x00, 0x08, 0xF8, 0x00, 0x0C, 0xF4, 0x00,
+  0x1F, 0xF0, 0x00, 0x5F, 0xB0, 0x00, 0x9F, 0x70, 0x00, 0xDF, 0x30, 0x00,
+  0x00, 0x8D, 0xFD, 0x80, 0x00, 0xAF, 0xFF, 0xFF, 0xA0, 0x4F, 0xE4, 0x04,
+  0xEF, 0x4A, 0xF7, 0x00, 0x07, 0xFA, 0xDF, 0x30, 0x00, 0x3F, 0xDE, 0xF1,
+  0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xF1, 0x00, 0x01, 0xFE,
+  0xDF, 0x30, 0x00, 0x3F, 0xDA, 0xF7, 0x00, 0x07, 0xFA, 0x4F, 0xE4, 0x04,
+  0xEF, 0x40, 0xAF, 0xFF, 0xFF, 0xA0, 0x00, 0x8D, 0xFD, 0x80, 0x00, 0x27,
+  0xCF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xD8, 0x2F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x39, 0xCE, 0xDA, 0x30, 0x0F, 0xFF, 0xFF, 0xFF, 0x50,
+  0xC6, 0x21, 0x3C, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00,
+  0x5F, 0xE3, 0x00, 0x00, 0x6F, 0xF5, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x00,
+  0x7F, 0xF6, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x10, 0x38, 0xCE, 0xED, 0x93, 0x0F, 0xFF, 0xFF, 0xFF, 0xF5, 0xC6,
+  0x31, 0x13, 0xAF, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x13, 0xAF,
+  0x90, 0x0F, 0xFF, 0xFD, 0x70, 0x00, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x01,
+  0x4C, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0xC5,
+  0x20, 0x14, 0xCF, 0xBF, 0xFF, 0xFF, 0xFF, 0xE2, 0x39, 0xDF, 0xEC, 0x81,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x00, 0x00,
+  0x02, 0xE7, 0xFF, 0x00, 0x00, 0x0B, 0xC0, 0xFF, 0x00, 0x00, 0x6F, 0x30,
+  0xFF, 0x00, 0x02, 0xE7, 0x00, 0xFF, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x00,
+  0x7F, 0x30, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
+  0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
+  0xFC, 0x40, 0x0F, 0xFF, 0xFF, 0xF3, 0x0A, 0x31, 0x4D, 0xFA, 0x00, 0x00,
+  0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x04, 0xFE, 0xB4, 0x11,
+  0x5D, 0xF9, 0xFF, 0xFF, 0xFF, 0xE2, 0x3A, 0xDF, 0xD9, 0x20, 0x00, 0x3A,
+  0xEE, 0xB4, 0x00, 0x5F, 0xFF, 0xFF, 0xF0, 0x1E, 0xFB, 0x30, 0x3B, 0x08,
+  0xFD, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x0E, 0xF3, 0x9E, 0xEB,
+  0x30, 0xFF, 0xAF, 0xFF, 0xFF, 0x4E, 0xFB, 0x30, 0x3B, 0xFB, 0xDF, 0x20,
+  0x00, 0x2F, 0xE9, 0xF2, 0x00, 0x02, 0xFE, 0x4F, 0xB2, 0x02, 0xBF, 0xB0,
+  0xAF, 0xFF, 0xFF, 0xE3, 0x00, 0x7D, 0xFE, 0xA3, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x0E,
+  0xF2, 0x00, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0xEF,
+  0x30, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, 0x0D, 0xF4,
+  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0xDF, 0x40,
+  0x00, 0x04, 0xBD, 0xFD, 0xB4, 0x06, 0xFF, 0xFF, 0xFF, 0xF6, 0xEF, 0x92,
+  0x02, 0x9F, 0xDE, 0xF1, 0x00, 0x01, 0xFE, 0x9F, 0x92, 0x02, 0x9F, 0x90,
+  0x7D, 0xFF, 0xFD, 0x70, 0x08, 0xEF, 0xFF, 0xE8, 0x08, 0xFB, 0x20, 0x3B,
+  0xF8, 0xEF, 0x20, 0x00, 0x2F, 0xEF, 0xF2, 0x00, 0x02, 0xFF, 0xCF, 0xB2,
+  0x02, 0xBF, 0xC4, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xAD, 0xFE, 0xB3, 0x00,
+  0x03, 0xAE, 0xFD, 0x70, 0x03, 0xEF, 0xFF, 0xFF, 0x90, 0xBF, 0xB3, 0x03,
+  0xBF, 0x4E, 0xF2, 0x00, 0x02, 0xF9, 0xEF, 0x20, 0x00, 0x2F, 0xDB, 0xFB,
+  0x20, 0x2B, 0xFE, 0x4F, 0xFF, 0xFF, 0xAF, 0xF0, 0x4B, 0xEE, 0x93, 0xFE,
+  0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x0D, 0xF8, 0x0B, 0x31, 0x2B,
+  0xFE, 0x10, 0xFF, 0xFF, 0xFF, 0x50, 0x04, 0xBE, 0xEA, 0x30, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xD6, 0xE3, 0xC6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC0, 0x00, 0x00, 0x04, 0xAF, 0xFF,
+  0x00, 0x02, 0x7D, 0xFF, 0xFB, 0x50, 0x5B, 0xFF, 0xFD, 0x72, 0x00, 0xEF,
+  0xFF, 0xA4, 0x00, 0x00, 0x0E, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x05, 0xBF,
+  0xFF, 0xD7, 0x20, 0x00, 0x00, 0x27, 0xDF, 0xFF, 0xB5, 0x00, 0x00, 0x00,
+  0x4A, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xA4, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFD, 0x72, 0x00, 0x00, 0x02, 0x7D,
+  0xFF, 0xFB, 0x50, 0x00, 0x00, 0x04, 0xAF, 0xFF, 0xE0, 0x00, 0x00, 0x4A,
+  0xFF, 0xFE, 0x00, 0x27, 0xDF, 0xFF, 0xB5, 0x05, 0xBF, 0xFF, 0xD7, 0x20,
+  0x00, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x0C, 0x61, 0x00, 0x00, 0x00, 0x00,
+  0x3A, 0xDE, 0xC6, 0x0F, 0xFF, 0xFF, 0xF7, 0xC5, 0x11, 0x9F, 0xD0, 0x00,
+  0x01, 0xFE, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x2D, 0xC1, 0x00, 0x2D, 0xD1,
+  0x00, 0x0C, 0xF3, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0xCE, 0xFD, 0xB6, 0x10, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xD5, 0x00, 0x00, 0xBF, 0xF9, 0x41, 0x02, 0x5B, 0xFF, 0x60, 0x09, 0xFE,
+  0x30, 0x00, 0x00, 0x00, 0x6F, 0xF3, 0x3F, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFA, 0x9F, 0x90, 0x02, 0xCE, 0x3F, 0xF0, 0x02, 0xFE, 0xDF, 0x30,
+  0x0B, 0xFF, 0xCF, 0xF0, 0x01, 0xFF, 0xEF, 0x10, 0x0E, 0xF3, 0x3F, 0xF0,
+  0x06, 0xFC, 0xEF, 0x10, 0x0E, 0xF3, 0x3F, 0xF2, 0x7E, 0xF5, 0xDF, 0x30,
+  0x0B, 0xFF, 0xCF, 0xFF, 0xFE, 0x60, 0x9F, 0x80, 0x02, 0xCE, 0x3F, 0xDB,
+  0x71, 0x00, 0x4F, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xE8, 0x31, 0x13, 0x8D,
+  0x30, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00,
+  0x4A, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
+  0x00, 0x02, 0xFC, 0xCF, 0x30, 0x00, 0x00, 0x09, 0xF6, 0x5F, 0x90, 0x00,
+  0x00, 0x1E, 0xE1, 0x0E, 0xE1, 0x00, 0x00, 0x6F, 0xA0, 0x08, 0xF6, 0x00,
+  0x00, 0xCF, 0x40, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x1E, 0xF2, 0x00, 0x00, 0x2F, 0xE1,
+  0x6F, 0xB0, 0x00, 0x00, 0x0B, 0xF6, 0xCF, 0x50, 0x00, 0x00, 0x05, 0xFC,
+  0xFF, 0xFF, 0xEC, 0x60, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x17,
+  0xFE, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x17, 0xFA, 0x0F, 0xFF,
+  0xFF, 0xF9, 0x10, 0xFF, 0xFF, 0xFF, 0xD6, 0x0F, 0xF0, 0x00, 0x3B, 0xF6,
+  0xFF, 0x00, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x03,
+  0xBF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFE, 0xA3, 0x00, 0x00,
+  0x06, 0xBE, 0xFE, 0xC8, 0x30, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFD,
+  0x62, 0x01, 0x37, 0xC6, 0xFD, 0x10, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00,
+  0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00,
+  0x06, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x0C, 0xFD, 0x62, 0x01, 0x36, 0xC0,
+  0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0xBE, 0xFE, 0xC8, 0x30, 0xFF,
+  0xFF, 0xED, 0xB6, 0x10, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0xFF, 0x00,
+  0x02, 0x6D, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x1C, 0xF7, 0xFF, 0x00, 0x00,
+  0x00, 0x5F, 0xCF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x5F,
+  0xCF, 0xF0, 0x00, 0x00, 0x1C, 0xF7, 0xFF, 0x00, 0x02, 0x6D, 0xFE, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0xFF, 0xFF, 0xED, 0xB6, 0x10, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBE, 0xFD, 0xC8,
+  0x30, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0xFD, 0x52, 0x01, 0x37, 0xC6,
+  0xFD, 0x10, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x0E, 0xF1,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xF1, 0x00,
+  0x00, 0x00, 0xFF, 0xCF, 0x50, 0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00,
+  0x00, 0xFF, 0x1D, 0xFC, 0x41, 0x02, 0x7F, 0xF0, 0x3D, 0xFF, 0xFF, 0xFF,
+  0xF6, 0x00, 0x17, 0xCE, 0xFD, 0x92, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xFD,
+  0x02, 0xBF, 0xAF, 0xFF, 0xF3, 0xFE, 0xB4, 0x00, 0xFF, 0x00, 0x00, 0x2D,
+  0xF7, 0x0F, 0xF0, 0x00, 0x2D, 0xF6, 0x00, 0xFF, 0x00, 0x2E, 0xF6, 0x00,
+  0x0F, 0xF0, 0x3E, 0xF5, 0x00, 0x00, 0xFF, 0x3E, 0xF4, 0x00, 0x00, 0x0F,
+  0xFE, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x0F, 0xF4,
+  0xFE, 0x30, 0x00, 0x00, 0xFF, 0x05, 0xFE, 0x30, 0x00, 0x0F, 0xF0, 0x05,
+  0xFE, 0x30, 0x00, 0xFF, 0x00, 0x06, 0xFE, 0x40, 0x0F, 0xF0, 0x00, 0x06,
+  0xFE, 0x40, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x40, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF6, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xEB, 0x00, 0x00, 0xAE, 0xFF,
+  0xFF, 0xAF, 0x20, 0x01, 0xF9, 0xFF, 0xFF, 0x4F, 0x80, 0x07, 0xF4, 0xFF,
+  0xFF, 0x0D, 0xD0, 0x0C, 0xD0, 0xFF, 0xFF, 0x08, 0xF4, 0x3F, 0x80, 0xFF,
+  0xFF, 0x02, 0xF9, 0x9F, 0x20, 0xFF, 0xFF, 0x00, 0xCE, 0xEB, 0x00, 0xFF,
+  0xFF, 0x00, 0x6F, 0xF6, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0xE1, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF,
+  0xF2, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0x50,
+  0x00, 0xFF, 0xFF, 0x2F, 0xD0, 0x00, 0xFF, 0xFF, 0x08, 0xF7, 0x00, 0xFF,
+  0xFF, 0x01, 0xEE, 0x20, 0xFF, 0xFF, 0x00, 0x6F, 0xA0, 0xFF, 0xFF, 0x00,
+  0x0C, 0xF4, 0xFF, 0xFF, 0x00, 0x04, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0xAF,
+  0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0x00,
+  0x18, 0xCE, 0xEC, 0x81, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFD, 0x20, 0x1D,
+  0xFC, 0x41, 0x14, 0xCF, 0xD1, 0x7F, 0xD1, 0x00, 0x00, 0x1D, 0xF6, 0xBF,
+  0x50, 0x00, 0x00, 0x05, 0xFB, 0xEF, 0x10, 0x00, 0x00, 0x01, 0xFE, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x10, 0x00, 0x00, 0x01, 0xFE, 0xBF,
+  0x50, 0x00, 0x00, 0x05, 0xFB, 0x7F, 0xD1, 0x00, 0x00, 0x1D, 0xF6, 0x1D,
+  0xFC, 0x41, 0x14, 0xCF, 0xD1, 0x02, 0xDF, 0xFF, 0xFF, 0xFD, 0x20, 0x00,
+  0x18, 0xCE, 0xEC, 0x81, 0x00, 0xFF, 0xFF, 0xEB, 0x40, 0xFF, 0xFF, 0xFF,
+  0xF5, 0xFF, 0x00, 0x2A, 0xFC, 0xFF, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x01,
+  0xFE, 0xFF, 0x00, 0x2A, 0xFC, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xEB,
+  0x40, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE,
+  0xEC, 0x81, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFD, 0x30, 0x1D, 0xFC, 0x41,
+  0x14, 0xCF, 0xD1, 0x7F, 0xD1, 0x00, 0x00, 0x1D, 0xF7, 0xBF, 0x50, 0x00,
+  0x00, 0x05, 0xFC, 0xEF, 0x10, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xEF, 0x10, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x50, 0x00,
+  0x00, 0x05, 0xFA, 0x7F, 0xD1, 0x00, 0x00, 0x1D, 0xF4, 0x1D, 0xFC, 0x41,
+  0x14, 0xCF, 0xA0, 0x03, 0xDF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x18, 0xCE,
+  0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0x40, 0xFF, 0xFF, 0xEC, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xF5,
+  0x00, 0xFF, 0x00, 0x1A, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFF,
+  0x00, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x1A, 0xFA, 0x00, 0xFF, 0xFF, 0xFF,
+  0xC1, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0x00, 0x5F, 0xF3, 0x00,
+  0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xDF, 0x60, 0xFF, 0x00,
+  0x00, 0x4F, 0xE2, 0xFF, 0x00, 0x00, 0x0A, 0xFA, 0x03, 0xAD, 0xED, 0x93,
+  0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x00, 0xCF, 0xB3, 0x02, 0x5C, 0x00, 0xFF,
+  0x10, 0x00, 0x00, 0x00, 0xDF, 0x71, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xDA,
+  0x50, 0x00, 0x04, 0xAE, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x26, 0xDF, 0x90,
+  0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xC7, 0x31,
+  0x13, 0xBF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x38, 0xCE, 0xFD, 0xA4,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xEF,
+  0x10, 0x00, 0x01, 0xFE, 0xCF, 0x50, 0x00, 0x05, 0xFC, 0x7F, 0xE5, 0x11,
+  0x5E, 0xF6, 0x0C, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x7C, 0xFE, 0xC7, 0x10,
+  0xCF, 0x50, 0x00, 0x00, 0x05, 0xFC, 0x6F, 0xB0, 0x00, 0x00, 0x0B, 0xF6,
+  0x1E, 0xF2, 0x00, 0x00, 0x2F, 0xE1, 0x09, 0xF7, 0x00, 0x00, 0x7F, 0x90,
+  0x03, 0xFD, 0x00, 0x00, 0xDF, 0x30, 0x00, 0xCF, 0x40, 0x04, 0xFD, 0x00,
+  0x00, 0x7F, 0xA0, 0x0A, 0xF7, 0x00, 0x00, 0x1F, 0xE1, 0x1E, 0xF1, 0x00,
+  0x00, 0x0A, 0xF6, 0x6F, 0xA0, 0x00, 0x00, 0x04, 0xFC, 0xCF, 0x40, 0x00,
+  0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0xDF, 0x30, 0x00, 0x4F, 0xFF, 0x20,
+  0x00, 0x3F, 0xD9, 0xF7, 0x00, 0x07, 0xFF, 0xF6, 0x00, 0x07, 0xF9, 0x5F,
+  0xA0, 0x00, 0xBF, 0x9F, 0xA0, 0x00, 0xAF, 0x51, 0xFE, 0x00, 0x0E, 0xF2,
+  0xFE, 0x00, 0x0E, 0xF1, 0x0D, 0xF3, 0x03, 0xFC, 0x0C, 0xF2, 0x03, 0xFC,
+  0x00, 0x9F, 0x70, 0x7F, 0x80, 0x8F, 0x60, 0x7F, 0x90, 0x05, 0xFB, 0x0B,
+  0xF5, 0x04, 0xFA, 0x0A, 0xF5, 0x00, 0x1F, 0xE0, 0xEF, 0x10, 0x1F, 0xE0,
+  0xEF, 0x10, 0x00, 0xCF, 0x6F, 0xC0, 0x00, 0xCF, 0x6F, 0xC0, 0x00, 0x08,
+  0xFD, 0xF8, 0x00, 0x08, 0xFD, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00,
+  0x4F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF1, 0x00, 0x01, 0xFF, 0xF1, 0x00,
+  0x00, 0x0C, 0xFC, 0x00, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x0B, 0xFA, 0x00,
+  0x00, 0xBF, 0xA0, 0x2F, 0xF4, 0x00, 0x6F, 0xE1, 0x00, 0x8F, 0xD0, 0x2E,
+  0xF5, 0x00, 0x01, 0xDF, 0x7B, 0xFB, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x20,
+  0x00, 0x00, 0x0B, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xC0, 0x00, 0x00, 0x1E, 0xF7, 0xEF, 0x60, 0x00, 0x0A,
+  0xFB, 0x06, 0xFE, 0x10, 0x05, 0xFE, 0x20, 0x0C, 0xF8, 0x01, 0xEF, 0x70,
+  0x00, 0x4F, 0xF2, 0xAF, 0xC0, 0x00, 0x00, 0xAF, 0xB0, 0xAF, 0xC0, 0x00,
+  0x00, 0x0C, 0xF9, 0x1D, 0xF7, 0x00, 0x00, 0x7F, 0xD1, 0x03, 0xFE, 0x20,
+  0x02, 0xEF, 0x30, 0x00, 0x7F, 0xB0, 0x0B, 0xF6, 0x00, 0x00, 0x0A, 0xF6,
+  0x6F, 0xA0, 0x00, 0x00, 0x01, 0xDE, 0xED, 0x10, 0x00, 0x00, 0x00, 0x4F,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x20, 0x00, 0x00, 0x08, 0xFF,
+  0x30, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x00, 0x02, 0xEF, 0x90, 0x00,
+  0x00, 0x01, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0xAF, 0xD1, 0x00, 0x00, 0x00,
+  0x7F, 0xE3, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x2E, 0xF8,
+  0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
+  0x30, 0x00, 0x9F, 0x70, 0x00, 0x5F, 0xB0, 0x00, 0x1F, 0xF0, 0x00, 0x0C,
+  0xF4, 0x00, 0x08, 0xF8, 0x00, 0x04, 0xFC, 0x00, 0x01, 0xFF, 0x10, 0x00,
+  0xCF, 0x50, 0x00, 0x8F, 0x80, 0x00, 0x4F, 0xC0, 0x00, 0x0E, 0xF1, 0x00,
+  0x0B, 0xF5, 0x00, 0x07, 0xF9, 0x00, 0x03, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xCF, 0xC1, 0x00, 0x00, 0x00, 0xBF,
+  0xAF, 0xB0, 0x00, 0x00, 0xAF, 0x60, 0x6F, 0xA0, 0x00, 0x9F, 0x50, 0x00,
+  0x5F, 0x90, 0x8E, 0x40, 0x00, 0x00, 0x4E, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x20, 0x0A, 0xC0, 0x00, 0xB9, 0x04,
+  0xAE, 0xEC, 0x40, 0x0F, 0xFF, 0xFF, 0xF3, 0x0B, 0x31, 0x2A, 0xFA, 0x00,
+  0x00, 0x01, 0xFD, 0x07, 0xCE, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xEF,
+  0x61, 0x01, 0xFF, 0xEF, 0x50, 0x2A, 0xFF, 0xAF, 0xFF, 0xFA, 0xFF, 0x1A,
+  0xEE, 0x91, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x19, 0xEE,
+  0xA2, 0x0F, 0xFA, 0xFF, 0xFF, 0xD1, 0xFF, 0xD4, 0x14, 0xDF, 0x8F, 0xF5,
+  0x00, 0x05, 0xFD, 0xFF, 0x10, 0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x01, 0xFF,
+  0xFF, 0x50, 0x00, 0x5F, 0xDF, 0xFD, 0x41, 0x4D, 0xF8, 0xFF, 0xAF, 0xFF,
+  0xFD, 0x1F, 0xF1, 0x9E, 0xEA, 0x20, 0x00, 0x7C, 0xEE, 0xB4, 0x0B, 0xFF,
+  0xFF, 0xFF, 0x7F, 0xE6, 0x21, 0x4B, 0xCF, 0x60, 0x00, 0x00, 0xEF, 0x10,
+  0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x7F, 0xE6,
+  0x21, 0x4B, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x7C, 0xFE, 0xB4, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x00, 0xFF, 0x02, 0xAE, 0xE9, 0x1F, 0xF1, 0xDF, 0xFF, 0xFA,
+  0xFF, 0x8F, 0xD4, 0x14, 0xDF, 0xFD, 0xF5, 0x00, 0x05, 0xFF, 0xFF, 0x10,
+  0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x01, 0xFF, 0xDF, 0x50, 0x00, 0x5F, 0xF8,
+  0xFD, 0x41, 0x4D, 0xFF, 0x1D, 0xFF, 0xFF, 0xAF, 0xF0, 0x2A, 0xEE, 0x91,
+  0xFF, 0x00, 0x5B, 0xEF, 0xD8, 0x10, 0x0A, 0xFF, 0xFF, 0xFF, 0xC1, 0x6F,
+  0xD5, 0x11, 0x3C, 0xF8, 0xCF, 0x40, 0x00, 0x02, 0xFD, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x30, 0x00, 0x00, 0x00,
+  0x6F, 0xE6, 0x21, 0x13, 0x6C, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x4A,
+  0xDF, 0xEC, 0x83, 0x00, 0x08, 0xDF, 0xF0, 0x08, 0xFF, 0xFF, 0x00, 0xDF,
+  0x50, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x02, 0xAE, 0xE9, 0x1F, 0xF1, 0xEF, 0xFF, 0xFA,
+  0xFF, 0x8F, 0xD4, 0x14, 0xDF, 0xFD, 0xF4, 0x00, 0x05, 0xFF, 0xFF, 0x10,
+  0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x01, 0xFF, 0xDF, 0x40, 0x00, 0x4F, 0xF8,
+  0xFD, 0x41, 0x4D, 0xFF, 0x1E, 0xFF, 0xFF, 0xAF, 0xF0, 0x2B, 0xEE, 0x92,
+  0xFE, 0x00, 0x00, 0x00, 0x6F, 0xB0, 0xA4, 0x11, 0x6E, 0xF6, 0x0F, 0xFF,
+  0xFF, 0xFC, 0x00, 0x4B, 0xEF, 0xD8, 0x10, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x19, 0xEE, 0x80, 0xFF, 0xAF, 0xFF, 0xF6, 0xFF, 0xC3, 0x19, 0xFC, 0xFF,
+  0x30, 0x02, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0x17,
+  0xFC, 0xFF, 0xF7, 0xFD, 0x70, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x03, 0xEF, 0x7F, 0xF0, 0x04, 0xEF, 0x60, 0xFF, 0x05, 0xFF, 0x50,
+  0x0F, 0xF5, 0xFE, 0x40, 0x00, 0xFF, 0xFE, 0x30, 0x00, 0x0F, 0xFF, 0xF5,
+  0x00, 0x00, 0xFF, 0x6F, 0xF5, 0x00, 0x0F, 0xF0, 0x7F, 0xF6, 0x00, 0xFF,
+  0x00, 0x7F, 0xF7, 0x0F, 0xF0, 0x00, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19,
+  0xEE, 0x70, 0x1A, 0xEE, 0x80, 0xFF, 0xAF, 0xFF, 0xF5, 0xCF, 0xFF, 0xF5,
+  0xFF, 0xC3, 0x19, 0xFE, 0xC3, 0x19, 0xFC, 0xFF, 0x30, 0x01, 0xFF, 0x30,
+  0x01, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x19, 0xEE, 0x80,
+  0xFF, 0xAF, 0xFF, 0xF6, 0xFF, 0xC3, 0x19, 0xFC, 0xFF, 0x30, 0x02, 0xFE,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x7C, 0xEE, 0xC7, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x7F, 0xE6,
+  0x11, 0x6E, 0xF7, 0xCF, 0x60, 0x00, 0x06, 0xFC, 0xFF, 0x10, 0x00, 0x01,
+  0xFE, 0xFF, 0x10, 0x00, 0x01, 0xFE, 0xCF, 0x60, 0x00, 0x06, 0xFC, 0x7F,
+  0xE6, 0x11, 0x6E, 0xF7, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x7C, 0xFE,
+  0xC7, 0x00, 0xFF, 0x19, 0xEE, 0xA2, 0x0F, 0xFA, 0xFF, 0xFF, 0xD1, 0xFF,
+  0xD4, 0x14, 0xDF, 0x8F, 0xF5, 0x00, 0x05, 0xFD, 0xFF, 0x10, 0x00, 0x1F,
+  0xFF, 0xF1, 0x00, 0x01, 0xFF, 0xFF, 0x50, 0x00, 0x5F, 0xDF, 0xFD, 0x41,
+  0x4D, 0xF8, 0xFF, 0xAF, 0xFF, 0xFD, 0x1F, 0xF1, 0x9E, 0xEA, 0x20, 0xFF,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xAE, 0xE9, 0x1F, 0xF1, 0xDF, 0xFF,
+  0xFA, 0xFF, 0x8F, 0xD4, 0x14, 0xDF, 0xFD, 0xF5, 0x00, 0x05, 0xFF, 0xFF,
+  0x10, 0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x01, 0xFF, 0xDF, 0x50, 0x00, 0x5F,
+  0xF8, 0xFD, 0x41, 0x4D, 0xFF, 0x1D, 0xFF, 0xFF, 0xAF, 0xF0, 0x2A, 0xEE,
+  0x91, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x19, 0xEF, 0xFF,
+  0xAF, 0xFF, 0xFF, 0xD4, 0x10, 0xFF, 0x50, 0x00, 0xFF, 0x10, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x18, 0xDE, 0xDB, 0x40, 0x9F, 0xFF, 0xFF, 0xF0, 0xEF, 0x71,
+  0x14, 0xB0, 0xDF, 0xB7, 0x40, 0x00, 0x4E, 0xFF, 0xFD, 0x30, 0x01, 0x48,
+  0xDF, 0xB0, 0x00, 0x00, 0x1F, 0xE0, 0xB4, 0x11, 0x6F, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xA0, 0x3A, 0xDE, 0xD7, 0x10, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0E, 0xF4, 0x00, 0x0A, 0xFF, 0xFF, 0x02, 0xAE, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEF, 0x20, 0x03,
+  0xFF, 0xCF, 0x91, 0x3C, 0xFF, 0x6F, 0xFF, 0xFA, 0xFF, 0x08, 0xEE, 0x91,
+  0xFF, 0x1F, 0xF1, 0x00, 0x00, 0x1E, 0xE0, 0x0A, 0xF7, 0x00, 0x00, 0x6F,
+  0x80, 0x04, 0xFC, 0x00, 0x00, 0xCF, 0x20, 0x00, 0xDF, 0x20, 0x03, 0xFC,
+  0x00, 0x00, 0x7F, 0x80, 0x09, 0xF6, 0x00, 0x00, 0x1F, 0xD0, 0x1E, 0xE1,
+  0x00, 0x00, 0x0A, 0xF4, 0x6F, 0x90, 0x00, 0x00, 0x04, 0xF9, 0xCF, 0x30,
+  0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00,
+  0x00, 0x0F, 0xF1, 0x00, 0xCF, 0xC0, 0x01, 0xFF, 0x00, 0xCF, 0x40, 0x1F,
+  0xFF, 0x10, 0x4F, 0xB0, 0x08, 0xF7, 0x05, 0xFD, 0xF4, 0x07, 0xF8, 0x00,
+  0x4F, 0xA0, 0x8F, 0x5F, 0x80, 0xAF, 0x40, 0x01, 0xFD, 0x0C, 0xD0, 0xEC,
+  0x0D, 0xF1, 0x00, 0x0C, 0xF2, 0xF9, 0x09, 0xF2, 0xFC, 0x00, 0x00, 0x8F,
+  0x9F, 0x50, 0x5F, 0x8F, 0x80, 0x00, 0x05, 0xFF, 0xF1, 0x01, 0xFE, 0xF5,
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0C, 0xFF, 0x10, 0x00, 0x00, 0xDF, 0x80,
+  0x00, 0x8F, 0xD0, 0x00, 0xAF, 0xC0, 0x00, 0x0C, 0xFA, 0x1D, 0xF5, 0x00,
+  0x5F, 0xD1, 0x04, 0xFD, 0x00, 0xDF, 0x40, 0x00, 0x9F, 0x56, 0xF8, 0x00,
+  0x00, 0x1D, 0xDD, 0xC0, 0x00, 0x00, 0x1E, 0xDE, 0xE1, 0x00, 0x00, 0xAF,
+  0x67, 0xFA, 0x00, 0x05, 0xFC, 0x00, 0xDF, 0x50, 0x1E, 0xF4, 0x00, 0x5F,
+  0xE1, 0xAF, 0xC0, 0x00, 0x0C, 0xFA, 0x2F, 0xE1, 0x00, 0x00, 0x1E, 0xF2,
+  0x0A, 0xF7, 0x00, 0x00, 0x7F, 0xA0, 0x03, 0xFE, 0x00, 0x00, 0xDF, 0x30,
+  0x00, 0xBF, 0x60, 0x05, 0xFB, 0x00, 0x00, 0x4F, 0xC0, 0x0C, 0xF5, 0x00,
+  0x00, 0x0C, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x04, 0xFB, 0xAF, 0x60, 0x00,
+  0x00, 0x00, 0xCF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
+  0x00, 0x01, 0xBF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFD, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0x02, 0xEF, 0x70, 0x00, 0x0C,
+  0xFB, 0x00, 0x00, 0x9F, 0xE2, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x3E, 0xFA,
+  0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
+  0x9D, 0xEF, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x0E, 0xF6, 0x10, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x8F,
+  0xC0, 0x00, 0xFF, 0xFC, 0x30, 0x00, 0xFF, 0xFB, 0x20, 0x00, 0x02, 0xAF,
+  0xB0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
+  0xF0, 0x00, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x0D, 0xF7, 0x10, 0x00, 0x09,
+  0xFF, 0xFF, 0x00, 0x01, 0x9D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0xD9, 0x10, 0x00, 0xFF, 0xFF, 0xA0, 0x00, 0x01, 0x6F, 0xE0, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF1, 0x00,
+  0x00, 0x0C, 0xF8, 0x10, 0x00, 0x03, 0xCF, 0xFF, 0x00, 0x02, 0xBF, 0xFF,
+  0x00, 0x0B, 0xFA, 0x20, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x0F, 0xF0, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x7F, 0xD0, 0x00,
+  0xFF, 0xFF, 0x90, 0x00, 0xFF, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x8E, 0xFC, 0x84, 0x11, 0x5D, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDE, 0x61, 0x14, 0x8C, 0xFE, 0x91, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+const GFXglyph DejaVuSans9pt7bAA4Glyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1 },   // 0x20 ' '
+  {     0,   2,  13,   7,    3,  -12 },   // 0x21 '!'
+  {    13,   6,   5,   8,    1,  -12 },   // 0x22 '"'
+  {    28,  12,  14,  15,    1,  -13 },   // 0x23 '#'
+  {   112,  10,  17,  11,    1,  -13 },   // 0x24 '$'
+  {   197,  15,  13,  17,    1,  -12 },   // 0x25 '%'
+  {   295,  12,  13,  13,    1,  -12 },   // 0x26 '&'
+  {   373,   2,   5,   4,    1,  -12 },   // 0x27 '''
+  {   378,   4,  16,   7,    2,  -13 },   // 0x28 '('
+  {   410,   4,  16,   7,    1,  -13 },   // 0x29 ')'
+  {   442,   7,   8,   9,    1,  -12 },   // 0x2A '*'
+  {   470,  12,  12,  15,    2,  -11 },   // 0x2B '+'
+  {   542,   3,   4,   6,    1,   -1 },   // 0x2C ','
+  {   548,   5,   2,   7,    1,   -5 },   // 0x2D '-'
+  {   553,   2,   2,   6,    2,   -1 },   // 0x2E '.'
+  {   555,   6,  15,   6,    0,  -12 },   // 0x2F '/'
+  {   600,   9,  13,  11,    1,  -12 },   // 0x30 '0'
+  {   659,   8,  13,  11,    2,  -12 },   // 0x31 '1'
+  {   711,   9,  13,  11,    1,  -12 },   // 0x32 '2'
+  {   770,   9,  13,  11,    1,  -12 },   // 0x33 '3'
+  {   829,  10,  13,  11,    1,  -12 },   // 0x34 '4'
+  {   894,   8,  13,  11,    1,  -12 },   // 0x35 '5'
+  {   946,   9,  13,  11,    1,  -12 },   // 0x36 '6'
+  {  1005,   8,  13,  11,    1,  -12 },   // 0x37 '7'
+  {  1057,   9,  13,  11,    1,  -12 },   // 0x38 '8'
+  {  1116,   9,  13,  11,    1,  -12 },   // 0x39 '9'
+  {  1175,   2,   9,   6,    2,   -8 },   // 0x3A ':'
+  {  1184,   3,  11,   6,    1,   -8 },   // 0x3B ';'
+  {  1201,  11,  10,  15,    2,   -9 },   // 0x3C '<'
+  {  1256,  11,   6,  15,    2,   -8 },   // 0x3D '='
+  {  1289,  11,  10,  15,    2,   -9 },   // 0x3E '>'
+  {  1344,   7,  13,  10,    1,  -12 },   // 0x3F '?'
+  {  1390,  16,  16,  18,    1,  -12 },   // 0x40 '@'
+  {  1518,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {  1596,   9,  13,  12,    2,  -12 },   // 0x42 'B'
+  {  1655,  11,  13,  13,    1,  -12 },   // 0x43 'C'
+  {  1727,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {  1799,   8,  13,  11,    2,  -12 },   // 0x45 'E'
+  {  1851,   8,  13,  10,    2,  -12 },   // 0x46 'F'
+  {  1903,  11,  13,  14,    1,  -12 },   // 0x47 'G'
+  {  1975,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {  2040,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {  2053,   5,  17,   6,   -1,  -12 },   // 0x4A 'J'
+  {  2096,  11,  13,  12,    2,  -12 },   // 0x4B 'K'
+  {  2168,   8,  13,  10,    2,  -12 },   // 0x4C 'L'
+  {  2220,  12,  13,  16,    2,  -12 },   // 0x4D 'M'
+  {  2298,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {  2363,  12,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {  2441,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {  2493,  12,  15,  14,    1,  -12 },   // 0x51 'Q'
+  {  2583,  10,  13,  13,    2,  -12 },   // 0x52 'R'
+  {  2648,  10,  13,  11,    1,  -12 },   // 0x53 'S'
+  {  2713,  12,  13,  12,    0,  -12 },   // 0x54 'T'
+  {  2791,  10,  13,  14,    2,  -12 },   // 0x55 'U'
+  {  2856,  12,  13,  12,    0,  -12 },   // 0x56 'V'
+  {  2934,  17,  13,  19,    1,  -12 },   // 0x57 'W'
+  {  3045,  11,  13,  13,    1,  -12 },   // 0x58 'X'
+  {  3117,  12,  13,  12,    0,  -12 },   // 0x59 'Y'
+  {  3195,  11,  13,  13,    1,  -12 },   // 0x5A 'Z'
+  {  3267,   4,  16,   7,    1,  -13 },   // 0x5B '['
+  {  3299,   6,  15,   6,    0,  -12 },   // 0x5C '\'
+  {  3344,   4,  16,   7,    2,  -13 },   // 0x5D ']'
+  {  3376,  11,   5,  15,    2,  -12 },   // 0x5E '^'
+  {  3404,   9,   2,   9,    0,    3 },   // 0x5F '_'
+  {  3413,   4,   3,   9,    2,  -13 },   // 0x60 '`'
+  {  3419,   8,  10,  10,    1,   -9 },   // 0x61 'a'
+  {  3459,   9,  14,  11,    2,  -13 },   // 0x62 'b'
+  {  3522,   8,  10,   9,    1,   -9 },   // 0x63 'c'
+  {  3562,   9,  14,  11,    1,  -13 },   // 0x64 'd'
+  {  3625,  10,  10,  11,    1,   -9 },   // 0x65 'e'
+  {  3675,   7,  14,   6,    0,  -13 },   // 0x66 'f'
+  {  3724,   9,  14,  11,    1,   -9 },   // 0x67 'g'
+  {  3787,   8,  14,  11,    2,  -13 },   // 0x68 'h'
+  {  3843,   2,  14,   5,    2,  -13 },   // 0x69 'i'
+  {  3857,   4,  18,   5,    0,  -13 },   // 0x6A 'j'
+  {  3893,   9,  14,  10,    2,  -13 },   // 0x6B 'k'
+  {  3956,   2,  14,   5,    2,  -13 },   // 0x6C 'l'
+  {  3970,  14,  10,  17,    2,   -9 },   // 0x6D 'm'
+  {  4040,   8,  10,  11,    2,   -9 },   // 0x6E 'n'
+  {  4080,  10,  10,  11,    1,   -9 },   // 0x6F 'o'
+  {  4130,   9,  14,  11,    2,   -9 },   // 0x70 'p'
+  {  4193,   9,  14,  11,    1,   -9 },   // 0x71 'q'
+  {  4256,   6,  10,   8,    2,   -9 },   // 0x72 'r'
+  {  4286,   8,  10,   8,    1,   -9 },   // 0x73 's'
+  {  4326,   6,  13,   7,    1,  -12 },   // 0x74 't'
+  {  4365,   8,  10,  11,    2,   -9 },   // 0x75 'u'
+  {  4405,  12,  10,  11,    0,   -9 },   // 0x76 'v'
+  {  4465,  15,  10,  16,    1,   -9 },   // 0x77 'w'
+  {  4540,  10,  10,  11,    1,   -9 },   // 0x78 'x'
+  {  4590,  12,  14,  11,    0,   -9 },   // 0x79 'y'
+  {  4674,   8,  10,   9,    1,   -9 },   // 0x7A 'z'
+  {  4714,   8,  17,  11,    2,  -13 },   // 0x7B '{'
+  {  4782,   2,  18,   6,    2,  -13 },   // 0x7C '|'
+  {  4800,   8,  17,  11,    2,  -13 },   // 0x7D '}'
+  {  4868,  11,   5,  15,    2,   -8 } }; // 0x7E '~'
+
+const GFXfont DejaVuSans9pt7bAA4 PROGMEM = {
+  (uint8_t  *)DejaVuSans9pt7bAA4Bitmaps,
+  (GFXglyph *)DejaVuSans9pt7bAA4Glyphs,
+  0x20, 0x7E, 21, GFX_FONT_AA4 };
+
+// Approx. 5572 bytes
@@ -0,0 +1,160 @@
+// Arduino core, Wire and SSD1306 stand-ins for the host build; see mock.h
+
+#include "mock.h"
+#include "SPI.h"
+#include "Wire.h"
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+
+unsigned long mock_ms = 0;
+uint8_t mock_pins[32] = {HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH,
+                         HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH,
+                         HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH,
+                         HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH, HIGH};
+
+unsigned long millis(void) { return mock_ms; }
+unsigned long micros(void) { return mock_ms * 1000; }
+void delay(unsigned long ms) { mock_ms += ms; }
+void delayMicroseconds(unsigned int) {}
+void yield(void) {}
+void pinMode(uint8_t, uint8_t) {}
+int digitalRead(uint8_t pin) { return mock_pins[pin & 31]; }
+void analogWrite(uint8_t, int) {}
+int analogRead(uint8_t) { return 512; }
+
+void tft_pin(uint8_t pin, uint8_t val); // mock_tft.cpp
+void digitalWrite(uint8_t pin, uint8_t val) { tft_pin(pin, val); }
+
+uint32_t fnv1a(const void *p, size_t n) {
+  const uint8_t *b = (const uint8_t *)p;
+  uint32_t h = 2166136261UL;
+  while (n--)
+    h = (h ^ *b++) * 16777619UL;
+  return h;
+}
+
+unsigned long heap_allocs = 0;
+
+extern "C" {
+void *__real_malloc(size_t n);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t n);
+
+void *__wrap_malloc(size_t n) {
+  heap_allocs++;
+  return __real_malloc(n);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+  heap_allocs++;
+  return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *p, size_t n) {
+  heap_allocs++;
+  return __real_realloc(p, n);
+}
+}
+
+// SSD1306 ------------------------------------------------------------------
+
+uint8_t oled_ram[8][128];
+unsigned long wire_bytes = 0;
+double wire_us = 0;
+
+static bool control;          // Next byte is the control byte
+static bool data;             // Transmission is display RAM data (0x40)
+static uint8_t cmd[3], cmdLen, cmdNeed;
+static uint8_t page0 = 0, page1 = 7, col0 = 0, col1 = 127, page, col;
+
+// Argument bytes following each command the driver sends
+static uint8_t argCount(uint8_t c) {
+  switch (c) {
+  case 0x20: // MEMORYMODE
+  case 0x81: // SETCONTRAST
+  case 0x8D: // CHARGEPUMP
+  case 0xA8: // SETMULTIPLEX
+  case 0xD3: // SETDISPLAYOFFSET
+  case 0xD5: // SETDISPLAYCLOCKDIV
+  case 0xD9: // SETPRECHARGE
+  case 0xDA: // SETCOMPINS
+  case 0xDB: // SETVCOMDETECT
+    return 1;
+  case 0x21: // COLUMNADDR
+  case 0x22: // PAGEADDR
+  case 0xA3: // SET_VERTICAL_SCROLL_AREA
+    return 2;
+  case 0x29: // Vertical and right horizontal scroll
+  case 0x2A: // Vertical and left horizontal scroll
+    return 5;
+  case 0x26: // RIGHT_HORIZONTAL_SCROLL
+  case 0x27: // LEFT_HORIZONTAL_SCROLL
+    return 6;
+  default:
+    return 0;
+  }
+}
+
+static void wireBits(unsigned bits) {
+  wire_us += bits * 1e6 / Wire.clock;
+}
+
+void TwoWire::beginTransmission(uint8_t) {
+  control = true;
+  wire_bytes++; // Address
+  wireBits(2 + 9);
+}
+
+size_t TwoWire::write(uint8_t b) {
+  wire_bytes++;
+  wireBits(9);
+  if (control) {
+    control = false;
+    data = (b == 0x40);
+  } else if (data) {
+    oled_ram[page][col] = b;
+    if (++col > col1) {
+      col = col0;
+      if (++page > page1)
+        page = page0;
+    }
+  } else if (cmdNeed) {
+    cmd[cmdLen++] = b;
+    if (!--cmdNeed) {
+      if (cmd[0] == 0x21) {
+        col = col0 = cmd[1] & 127;
+        col1 = cmd[2] & 127;
+      } else if (cmd[0] == 0x22) {
+        page = page0 = cmd[1] & 7;
+        page1 = cmd[2] & 7;
+      }
+    }
+  } else {
+    cmd[0] = b;
+    cmdLen = 1;
+    cmdNeed = argCount(b);
+  }
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(void) { return 0; }
+
+void oled_dump(const char *path) {
+  FILE *f = fopen(path, "wb");
+  if (!f) {
+    perror(path);
+    exit(1);
+  }
+  fprintf(f, "P4\n128 64\n");
+  for (uint8_t y = 0; y < 64; y++) {
+    for (uint8_t x = 0; x < 128; x += 8) {
+      uint8_t bits = 0;
+      for (uint8_t i = 0; i < 8; i++)
+        bits = (bits << 1) | ((oled_ram[y / 8][x + i] >> (y & 7)) & 1);
+      fputc(bits, f);
+    }
+  }
+  fclose(f);
+}
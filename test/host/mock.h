@@ -0,0 +1,40 @@
+// Host stand-ins for the hardware behind the display code: a clock the
+// tests advance, the button pins, an SSD1306 on Wire and an ILI9341-style
+// panel on SPI. Each panel decodes its bus stream into its own RAM, so
+// tests check what the panel would show, not what the driver buffered.
+
+#ifndef _HOST_MOCK_H_
+#define _HOST_MOCK_H_
+
+#include "Arduino.h"
+
+extern unsigned long mock_ms;  // millis(); delay() and tests advance it
+extern uint8_t mock_pins[32];  // digitalRead() levels, all HIGH (btns up)
+
+// SSD1306 on Wire. Bus time is 9 SCL periods a byte (8 bits and ACK) plus
+// 2 for START and STOP, at the clock set when the byte was sent
+extern uint8_t oled_ram[8][128]; // Page-major, as in the controller
+extern unsigned long wire_bytes; // Bytes on the bus, addresses included
+extern double wire_us;           // Bus time, in microseconds
+void oled_dump(const char *path); // Write oled_ram as a binary PBM
+
+// ILI9341-style panel on SPI: CASET, RASET and RAMWR are decoded, any
+// other command is only counted. Pixels land at their rotated
+// coordinates, as if the panel had applied MADCTL
+#define TFT_CS 10
+#define TFT_DC 9
+#define TFT_RAM 320 // Width and height of tft_ram, enough for any rotation
+extern uint16_t tft_ram[TFT_RAM][TFT_RAM];
+extern unsigned long tft_cmd_bytes, // Bytes sent with DC low
+    tft_data_bytes,                 // Bytes sent with DC high
+    tft_windows,                    // RAMWR commands
+    tft_selects;                    // Times CS went low
+void tft_reset_counts(void);
+
+uint32_t fnv1a(const void *p, size_t n); // Framebuffer fingerprint
+
+// malloc(), calloc() and realloc() calls made by the code under test (the
+// link wraps them; allocations inside libc and libstdc++ are not counted)
+extern unsigned long heap_allocs;
+
+#endif // _HOST_MOCK_H_
@@ -0,0 +1,67 @@
+// ILI9341-style SPI panel stand-in for the host build; see mock.h
+
+#include "mock.h"
+#include "SPI.h"
+
+uint16_t tft_ram[TFT_RAM][TFT_RAM];
+unsigned long tft_cmd_bytes, tft_data_bytes, tft_windows, tft_selects;
+
+static bool dc = true;
+static uint8_t cmd, argLen, arg[4];
+static uint16_t col0, col1, row0, row1, col, row;
+static int hi = -1; // First byte of a pixel, or -1
+
+void tft_reset_counts(void) {
+  tft_cmd_bytes = tft_data_bytes = tft_windows = tft_selects = 0;
+}
+
+void tft_pin(uint8_t pin, uint8_t val) {
+  if (pin == TFT_DC)
+    dc = val;
+  else if ((pin == TFT_CS) && !val)
+    tft_selects++;
+}
+
+uint8_t SPIClass::transfer(uint8_t b) {
+  if (!dc) {
+    tft_cmd_bytes++;
+    cmd = b;
+    argLen = 0;
+    hi = -1;
+    if (cmd == 0x2C) { // RAMWR
+      col = col0;
+      row = row0;
+      tft_windows++;
+    }
+    return 0;
+  }
+  tft_data_bytes++;
+  if ((cmd == 0x2A) || (cmd == 0x2B)) { // CASET, RASET
+    if (argLen < 4)
+      arg[argLen++] = b;
+    if (argLen == 4) {
+      uint16_t a = (arg[0] << 8) | arg[1], e = (arg[2] << 8) | arg[3];
+      if (cmd == 0x2A) {
+        col0 = a;
+        col1 = e;
+      } else {
+        row0 = a;
+        row1 = e;
+      }
+    }
+  } else if (cmd == 0x2C) {
+    if (hi < 0) {
+      hi = b;
+      return 0;
+    }
+    if ((col < TFT_RAM) && (row < TFT_RAM))
+      tft_ram[row][col] = (hi << 8) | b;
+    hi = -1;
+    if (++col > col1) {
+      col = col0;
+      if (++row > row1)
+        row = row0;
+    }
+  }
+  return 0;
+}
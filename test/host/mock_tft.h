@@ -0,0 +1,31 @@
+// An Adafruit_SPITFT panel on the host SPI mock; see mock.h
+
+#ifndef _HOST_MOCK_TFT_H_
+#define _HOST_MOCK_TFT_H_
+
+#include "Adafruit_SPITFT.h"
+#include "mock.h"
+
+class MockTFT : public Adafruit_SPITFT {
+public:
+  MockTFT(uint16_t w = 320, uint16_t h = 240)
+      : Adafruit_SPITFT(w, h, TFT_CS, TFT_DC, -1) {}
+  void begin(uint32_t freq = 0) { initSPI(freq); }
+  const GFXfont *font(void) const { return gfxFont; }
+  bool cp437On(void) const { return _cp437; }
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if defined(MOCK_TFT_DIRECT_WINDOW) // As drivers did before writeAddrWindow()
+    writeCommand(0x2A); // CASET
+    SPI_WRITE16(x);
+    SPI_WRITE16(x + w - 1);
+    writeCommand(0x2B); // RASET
+    SPI_WRITE16(y);
+    SPI_WRITE16(y + h - 1);
+    writeCommand(0x2C); // RAMWR
+#else
+    writeAddrWindow(x, y, x + w - 1, y + h - 1);
+#endif
+  }
+};
+
+#endif // _HOST_MOCK_TFT_H_
@@ -0,0 +1,52 @@
+// Print and Serial for the host build. Serial goes to stdout so that what
+// the firmware logs lands in the test output next to the test's own.
+
+#ifndef _HOST_PRINT_H_
+#define _HOST_PRINT_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "WString.h"
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t n) {
+    size_t r = 0;
+    while (n--)
+      r += write(*buf++);
+    return r;
+  }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printf_("%d", v); }
+  size_t print(unsigned int v) { return printf_("%u", v); }
+  size_t print(long v) { return printf_("%ld", v); }
+  size_t print(unsigned long v) { return printf_("%lu", v); }
+  size_t println(void) { return write((uint8_t)'\n'); }
+  template <class T> size_t println(T v) { return print(v) + println(); }
+
+private:
+  template <class T> size_t printf_(const char *fmt, T v) {
+    char buf[24];
+    snprintf(buf, sizeof buf, fmt, v);
+    return write(buf);
+  }
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif // _HOST_PRINT_H_
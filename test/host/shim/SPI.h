@@ -0,0 +1,34 @@
+// SPIClass for the host build: every byte goes to the panel decoder in
+// mock_tft.cpp.
+
+#ifndef _HOST_SPI_H_
+#define _HOST_SPI_H_
+
+#include "Arduino.h"
+
+#define SPI_HAS_TRANSACTION
+#define SPI_MODE0 0x00
+
+struct SPISettings {
+  SPISettings(uint32_t = 0, uint8_t = 0, uint8_t = 0) {}
+};
+
+class SPIClass {
+public:
+  void begin(void) {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction(void) {}
+  uint8_t transfer(uint8_t b);
+  uint16_t transfer16(uint16_t w) {
+    transfer(w >> 8);
+    transfer(w);
+    return 0;
+  }
+  void setClockDivider(uint8_t) {}
+  void setDataMode(uint8_t) {}
+  void setBitOrder(uint8_t) {}
+};
+
+extern SPIClass SPI;
+
+#endif // _HOST_SPI_H_
@@ -0,0 +1,36 @@
+// A minimal heap-backed String, allocating through malloc() like the AVR
+// core's, so the host allocation counts see it.
+
+#ifndef _HOST_WSTRING_H_
+#define _HOST_WSTRING_H_
+
+#include <stdlib.h>
+#include <string.h>
+
+class __FlashStringHelper;
+
+class String {
+public:
+  String(const char *s = "") { copy(s); }
+  String(const __FlashStringHelper *s) { copy((const char *)s); }
+  String(const String &s) { copy(s.buf); }
+  ~String() { free(buf); }
+  String &operator=(const String &s) {
+    if (this != &s) {
+      free(buf);
+      copy(s.buf);
+    }
+    return *this;
+  }
+  const char *c_str(void) const { return buf; }
+  unsigned int length(void) const { return strlen(buf); }
+
+private:
+  void copy(const char *s) {
+    buf = (char *)malloc(strlen(s) + 1);
+    strcpy(buf, s);
+  }
+  char *buf;
+};
+
+#endif // _HOST_WSTRING_H_
@@ -0,0 +1,23 @@
+// TwoWire for the host build: every byte goes to the SSD1306 decoder in
+// mock.cpp, which also keeps the bus time at the clock set when it was sent.
+
+#ifndef _HOST_WIRE_H_
+#define _HOST_WIRE_H_
+
+#include "Arduino.h"
+
+#define BUFFER_LENGTH 32
+
+class TwoWire {
+public:
+  void begin(void) {}
+  void setClock(uint32_t hz) { clock = hz; }
+  void beginTransmission(uint8_t addr);
+  size_t write(uint8_t b);
+  uint8_t endTransmission(void);
+  uint32_t clock = 100000; ///< SCL frequency in Hz, as the AVR core starts
+};
+
+extern TwoWire Wire;
+
+#endif // _HOST_WIRE_H_
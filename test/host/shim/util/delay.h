@@ -0,0 +1 @@
+#define _delay_ms(ms) delay(ms)
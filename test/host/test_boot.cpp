@@ -0,0 +1,34 @@
+// Runs the firmware loop's display and btn calls every 10 ms for 6 s after
+// UI_init(), and prints each time the panel changes. With "press", BTN_DOWN
+// is held from 0.5 s to 0.6 s, which skips the boot screens.
+//
+// Usage: test_boot [press]
+
+#include "UI.h"
+#include "mock.h"
+
+extern uint16union_t Display_State;
+
+int main(int argc, char **argv) {
+  bool press = (argc > 1) && !strcmp(argv[1], "press");
+  Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+  int speed = 6;
+
+  UI_init(&display);
+  unsigned long start = mock_ms;
+  printf("init took %lu ms, panel %08x\n", start,
+         fnv1a(oled_ram, sizeof oled_ram));
+  uint32_t last = 0;
+  for (; mock_ms - start < 6000; mock_ms += 10) {
+    mock_pins[BTN_DOWN] = (press && (mock_ms - start >= 500) &&
+                           (mock_ms - start < 600)) ? LOW : HIGH;
+    UI_updateDisplay(&display, speed);
+    UI_btnUpdate(&speed);
+    uint32_t h = fnv1a(oled_ram, sizeof oled_ram);
+    if (h != last)
+      printf("%4lu ms state %d.%d panel %08x\n", mock_ms - start,
+             Display_State.s.Hi, Display_State.s.Lo, h);
+    last = h;
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Sweeps the rectangle, line and shape primitives over zero, negative and
+// off-screen sizes and positions, on every display class in every
+// rotation, and prints one fingerprint per class, rotation and primitive
+// covering all of its cases.
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+
+#include "mock_tft.h"
+
+static const int16_t sizes[] = {-3, -1, 0, 1, 2, 5};
+static const int16_t places[] = {-4, -1, 0, 7, 30}; // 30: 1 in from the far edge
+
+static const char *const names[] = {
+    "fillRect",  "drawFastHLine", "drawFastVLine", "drawRect",
+    "writeFillRect", "writeFastHLine", "writeFastVLine", "drawRoundRect",
+    "fillRoundRect", "drawCircle", "fillCircle", "drawLine",
+    "fillTriangle"};
+#define OPS (sizeof names / sizeof names[0])
+
+static void op(Adafruit_GFX &g, uint8_t k, int16_t x, int16_t y, int16_t a,
+               int16_t b) {
+  switch (k) {
+  case 0: g.fillRect(x, y, a, b, 1); break;
+  case 1: g.drawFastHLine(x, y, a, 1); break;
+  case 2: g.drawFastVLine(x, y, b, 1); break;
+  case 3: g.drawRect(x, y, a, b, 1); break;
+  case 4: g.startWrite(); g.writeFillRect(x, y, a, b, 1); g.endWrite(); break;
+  case 5: g.startWrite(); g.writeFastHLine(x, y, a, 1); g.endWrite(); break;
+  case 6: g.startWrite(); g.writeFastVLine(x, y, b, 1); g.endWrite(); break;
+  case 7: g.drawRoundRect(x, y, a, b, 1, 1); break;
+  case 8: g.fillRoundRect(x, y, a, b, 1, 1); break;
+  case 9: if (a >= 0) g.drawCircle(x, y, a, 1); break;
+  case 10: if (a >= 0) g.fillCircle(x, y, a, 1); break;
+  case 11: g.drawLine(x, y, x + a, y + b, 1); break;
+  case 12: g.fillTriangle(x, y, x + a, y, x, y + b, 1); break;
+  }
+}
+
+static void sweep(const char *name, Adafruit_GFX &g, uint32_t (*print)(void)) {
+  for (uint8_t r = 0; r < 4; r++) {
+    g.setRotation(r);
+    for (uint8_t k = 0; k < OPS; k++) {
+      uint32_t h = 2166136261UL;
+      for (int16_t x : places)
+        for (int16_t y : places)
+          for (int16_t a : sizes)
+            for (int16_t b : sizes) {
+              g.fillScreen(0);
+              op(g, k, (x == 30) ? g.width() - 1 : x,
+                 (y == 30) ? g.height() - 1 : y, a, b);
+              h = (h ^ print()) * 16777619UL;
+            }
+      printf("%s r%d %s %08x\n", name, r, names[k], h);
+    }
+  }
+}
+
+static GFXcanvas1 c1(37, 21);
+static GFXcanvas8 c8(37, 21);
+static GFXcanvas16 c16(37, 21);
+static Adafruit_SSD1306 oled(128, 64, &Wire, -1);
+static MockTFT tft(37, 21);
+
+int main(void) {
+  sweep("canvas1", c1, [] { return fnv1a(c1.getBuffer(), 5 * 21); });
+  sweep("canvas8", c8, [] { return fnv1a(c8.getBuffer(), 37 * 21); });
+  sweep("canvas16", c16,
+        [] { return fnv1a(c16.getBuffer(), 37 * 21 * 2); });
+  oled.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  sweep("ssd1306", oled, [] { return fnv1a(oled.getBuffer(), 1024); });
+  tft.begin();
+  sweep("spitft", tft, [] { // 37 rows takes in every rotation
+    return fnv1a(tft_ram, sizeof tft_ram[0] * 37);
+  });
+  return 0;
+}
@@ -0,0 +1,115 @@
+// Draws one scene of every primitive, overlapping and off the edges, on the
+// SSD1306 in each rotation and on GFXcanvas1/8/16, and prints a fingerprint
+// of each framebuffer. The SSD1306's is taken both from its buffer and from
+// the panel RAM after display().
+//
+// Usage: test_prim [dir]   also writes the panel in each rotation to dir
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include <Fonts/FreeMonoBold12pt7b.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/Org_01.h>
+
+#include "mock.h"
+
+static void scene(Adafruit_GFX &g) {
+  g.setTextWrap(true);
+  g.setFont(NULL);
+  for (int rep = 0; rep < 3; rep++) {
+    uint16_t c1 = (rep == 2) ? 2 : 1, c0 = 0; // SSD1306_INVERSE the last time
+    g.fillRect(-5, -3, 40, 20, c1);
+    g.fillRect(100, 50, 60, 30, c1);
+    g.drawFastHLine(-10, 20, 200, c1);
+    g.drawFastVLine(70, -10, 100, c1);
+    g.drawFastHLine(3, 21, 13, c1);
+    g.drawFastVLine(3, 22, 13, c1);
+    g.drawLine(-50, -20, 180, 90, c1);
+    g.drawLine(127, 0, 0, 63, c1);
+    g.drawLine(-300, 10, 300, 40, c1);
+    g.drawLine(10, -300, 40, 300, c1);
+    g.drawLine(20, 5, 20, 60, c1);
+    g.drawLine(5, 30, 90, 30, c1);
+    g.drawLine(200, 200, 300, 300, c1);
+    g.drawLine(60, 60, 61, 80, c1);
+    g.drawCircle(64, 32, 40, c1);
+    g.drawCircle(0, 0, 20, c1);
+    g.fillCircle(120, 10, 25, c1);
+    g.fillCircle(-10, 60, 15, c1);
+    g.fillCircle(30, 40, 6, c1);
+    g.fillTriangle(64, 6, 59, 16, 69, 16, c1);
+    g.fillTriangle(64, 58, 59, 48, 69, 48, c1);
+    g.fillTriangle(-40, -30, 150, 20, 10, 90, c1);
+    g.fillTriangle(10, 10, 10, 10, 40, 10, c1);
+    g.fillTriangle(0, 70, 50, 70, 20, 100, c1);
+    g.drawRoundRect(5, 5, 60, 30, 8, c1);
+    g.fillRoundRect(70, 30, 50, 30, 6, c1);
+    g.drawTriangle(5, 60, 60, 2, 120, 60, c1);
+    for (uint8_t s = 1; s <= 3; s++) {
+      g.setTextSize(s);
+      g.setTextColor(c1);
+      g.setCursor(-3 + s, 3 * s - 4);
+      g.print("Ag-6 Emerg Stop  Enabled");
+      g.setTextColor(c0, c1);
+      g.setCursor(2, 40 + s);
+      g.print("x9%");
+      g.setTextColor(c1, c0);
+      g.setCursor(60, 17);
+      g.print("Hi");
+    }
+    g.setTextSize(2, 3);
+    g.setTextColor(c1);
+    g.setCursor(10, 8);
+    g.print("Wd");
+    g.setFont(&FreeSans9pt7b);
+    g.setTextSize(1);
+    g.setCursor(0, 30);
+    g.print("Speed -6 ENABLED");
+    g.setTextSize(2);
+    g.setCursor(-4, 50);
+    g.print("DIS 0");
+    g.setFont(&Org_01);
+    g.setTextSize(1);
+    g.setCursor(3, 60);
+    g.print("abc 123");
+    g.setFont(&FreeMonoBold12pt7b);
+    g.setCursor(40, 62);
+    g.print("Qj");
+    g.setFont(NULL);
+  }
+}
+
+int main(int argc, char **argv) {
+  Adafruit_SSD1306 oled(128, 64, &Wire, -1);
+  oled.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  printf("splash %08x\n", fnv1a(oled.getBuffer(), 1024));
+  for (uint8_t r = 0; r < 4; r++) {
+    oled.setRotation(r);
+    oled.clearDisplay();
+    scene(oled);
+    printf("oled r%d %08x\n", r, fnv1a(oled.getBuffer(), 1024));
+    oled.display();
+    printf("panel r%d %08x\n", r, fnv1a(oled_ram, sizeof oled_ram));
+    if (argc > 1) {
+      char path[256];
+      snprintf(path, sizeof path, "%s/prim_r%d.pbm", argv[1], r);
+      oled_dump(path);
+    }
+  }
+
+  for (uint8_t r = 0; r < 4; r++) {
+    GFXcanvas1 c1(101, 47);
+    c1.setRotation(r);
+    scene(c1);
+    printf("canvas1 r%d %08x\n", r, fnv1a(c1.getBuffer(), 13 * 47));
+    GFXcanvas8 c8(101, 47);
+    c8.setRotation(r);
+    scene(c8);
+    printf("canvas8 r%d %08x\n", r, fnv1a(c8.getBuffer(), 101 * 47));
+    GFXcanvas16 c16(101, 47);
+    c16.setRotation(r);
+    scene(c16);
+    printf("canvas16 r%d %08x\n", r, fnv1a(c16.getBuffer(), 101 * 47 * 2));
+  }
+  return 0;
+}
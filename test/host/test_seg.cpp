@@ -0,0 +1,50 @@
+// Steps seven-segment readouts of three sizes through a run of values on
+// the SSD1306, each update redrawing only the segments that changed, and
+// checks every step against the same value drawn in full on a clear
+// display. Prints a fingerprint of the buffer per step, and of the panel
+// RAM once display() has sent the last one.
+
+#include <Adafruit_SSD1306.h>
+
+#include "SEG.h"
+#include "mock.h"
+
+struct Size {
+  uint8_t w, h, t, gap, digits;
+};
+
+// A small one, the UI's speed readout, and one filling the panel
+static const Size sizes[] = {{8, 14, 2, 2, 3}, {16, 28, 4, 4, 2},
+                             {28, 56, 6, 4, 4}};
+
+// Every speed, then carries, signs and values too wide for some sizes
+static const int values[] = {-6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6,
+                             9, 10, 99, -10, -99, 100, 888, -888, 1234,
+                             -1234, 9999, 10000, 0};
+
+static Adafruit_SSD1306 oled(128, 64, &Wire, -1), ref(128, 64, &Wire, -1);
+
+int main(void) {
+  int failed = 0;
+  oled.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  ref.begin(SSD1306_SWITCHCAPVCC, 0x3C);
+  for (const Size &s : sizes) {
+    SEG_Readout_t r, full;
+    SEG_init(&r, 2, 4, s.w, s.h, s.t, s.gap, s.digits);
+    oled.clearDisplay();
+    for (int v : values) {
+      bool drew = SEG_draw(&oled, &r, v, SSD1306_WHITE, SSD1306_BLACK);
+      SEG_init(&full, 2, 4, s.w, s.h, s.t, s.gap, s.digits);
+      ref.clearDisplay();
+      SEG_draw(&ref, &full, v, SSD1306_WHITE, SSD1306_BLACK);
+      bool same = !memcmp(oled.getBuffer(), ref.getBuffer(), 1024);
+      printf("%dx%d/%d %d drew %d %08x%s\n", s.w, s.h, s.t, v, drew,
+             fnv1a(oled.getBuffer(), 1024), same ? "" : " differs from full");
+      failed += !same;
+    }
+    oled.display();
+    printf("%dx%d/%d panel %08x\n", s.w, s.h, s.t,
+           fnv1a(oled_ram, sizeof oled_ram));
+  }
+  return failed != 0;
+}
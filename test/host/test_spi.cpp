@@ -0,0 +1,42 @@
+// Draws the scenes of the GFX graphicstest demo on a 320x240 SPITFT panel
+// and prints, for each, the bytes the driver sent as commands and as data,
+// the address windows it opened (RAMWR commands) and the times it selected
+// the panel. Each scene is drawn over a test pattern, and the panel RAM is
+// checked against the same scene on a GFXcanvas16.
+
+#include "demo.h"
+#include "mock_tft.h"
+
+#define W DEMO_W
+#define H DEMO_H
+
+static MockTFT tft(W, H);
+static GFXcanvas16 ref(W, H);
+
+int main(void) {
+  unsigned long cmd = 0, data = 0, windows = 0, selects = 0;
+  int failed = 0;
+  tft.begin();
+  for (uint8_t k = 0; k < DEMO_SCENES; k++) {
+    for (int16_t y = 0; y < H; y++)
+      for (int16_t x = 0; x < W; x++)
+        tft_ram[y][x] = ref.getBuffer()[y * W + x] = x * 7 + y * 13;
+    tft_reset_counts();
+    demo(tft, k);
+    demo(ref, k);
+    int diff = 0;
+    for (int16_t y = 0; y < H; y++)
+      diff += memcmp(tft_ram[y], &ref.getBuffer()[y * W], W * 2) != 0;
+    printf("%-15s cmd %6lu data %7lu windows %5lu selects %5lu%s\n",
+           demoNames[k], tft_cmd_bytes, tft_data_bytes, tft_windows,
+           tft_selects, diff ? ", differs from canvas" : "");
+    failed += diff != 0;
+    cmd += tft_cmd_bytes;
+    data += tft_data_bytes;
+    windows += tft_windows;
+    selects += tft_selects;
+  }
+  printf("%-15s cmd %6lu data %7lu windows %5lu selects %5lu\n", "total", cmd,
+         data, windows, selects);
+  return failed != 0;
+}
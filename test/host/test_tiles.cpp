@@ -0,0 +1,94 @@
+// Draws the scenes of the GFX graphicstest demo through GFXtiles onto a
+// 320x240 SPITFT panel, in a few list, tile and band sizes, three frames
+// per scene: the scene over a few extra shapes, the same frame again, and
+// a frame with the extras moved; then the extras alone, which fit even
+// the AVR list. Prints the tiles display() sent and the bytes that took,
+// and checks the panel RAM after every frame against the same frame on a
+// GFXcanvas16, that the panel's own font settings are as they were, and
+// that a repeated frame which fits the list sends nothing.
+
+#include <Adafruit_SPITFT_Tiles.h>
+
+#include "demo.h"
+#include "mock_tft.h"
+
+#define W DEMO_W
+#define H DEMO_H
+
+struct Config {
+  uint16_t listBytes;
+  uint8_t tileW, tileH, bandH;
+  bool fits; // Every frame fits the list, not just the extras alone
+};
+
+// The AVR defaults, which overflow on most scenes but hold the extras
+// alone, then lists that hold every scene with the host's tile and band,
+// small tiles, and thin bands
+static const Config configs[] = {{256, 32, 32, 4, false},
+                                 {65000, 32, 32, 32, true},
+                                 {65000, 16, 16, 16, true},
+                                 {65000, 32, 32, 8, true}};
+
+static const uint8_t icon[] PROGMEM = {0xF0, 0x0F, 0x81, 0x81, 0x42, 0x42,
+                                       0x24, 0x24, 0x18, 0x18, 0xFF, 0xFF};
+static const uint16_t rgb[] PROGMEM = {1,  2,  3,  4,  5,  6,  7,  8,  9,
+                                       10, 11, 12, 13, 14, 15, 16, 17, 18};
+
+// Shapes the scenes don't use, some clipped at the edges; k moves them
+template <class G> static void extra(G &g, uint8_t k) {
+  g.drawBitmap(30 + k, 25, icon, 16, 6, 0xF800);
+  g.drawBitmap(300, 230, icon, 16, 6, 0x07E0, 0x001F);
+  g.drawRGBBitmap(-2, 100, rgb, 6, 3);
+  g.drawLine(-10, 5, 400, 300, 0x1234);
+  g.drawCircle(100, 100, 30 + k, 0xABCD);
+  g.fillCircle(-5, 200, 12 + k, 0x8410);
+  g.drawRoundRect(200, -4, 50, 20, 6, 0xFFE0);
+  g.fillRoundRect(310, 60, 20, 30 + k, 8, 0x07FF);
+  g.setFont(NULL);
+  g.setCursor(250, 200);
+  g.setTextColor(0xFFFF, 0);
+  g.setTextSize(2, 3);
+  g.print(k ? "xy" : "xz");
+}
+
+static MockTFT tft(W, H);
+static GFXcanvas16 ref(W, H);
+
+int main(void) {
+  int failed = 0;
+  tft.begin();
+  ref.cp437(true);
+  for (const Config &c : configs) {
+    GFXtiles tiles(&tft, c.listBytes, c.tileW, c.tileH, c.bandH);
+    tiles.cp437(true);
+    printf("list %u tile %ux%u band %u\n", c.listBytes, c.tileW, c.tileH,
+           c.bandH);
+    for (uint8_t k = 0; k <= DEMO_SCENES; k++) { // Then the extras alone
+      for (uint8_t pass = 0; pass < 3; pass++) {
+        tft_reset_counts();
+        tiles.fillScreen(0x0841);
+        if (k < DEMO_SCENES)
+          demo(tiles, k);
+        extra(tiles, pass == 2);
+        uint16_t sent = tiles.display();
+        ref.fillScreen(0x0841);
+        if (k < DEMO_SCENES)
+          demo(ref, k);
+        extra(ref, pass == 2);
+        int diff = 0;
+        for (int16_t y = 0; y < H; y++)
+          diff += memcmp(tft_ram[y], &ref.getBuffer()[y * W], W * 2) != 0;
+        bool font = tft.font() || tft.cp437On();
+        bool resent = (pass == 1) && sent && (c.fits || (k == DEMO_SCENES));
+        printf("%-15s %d tiles %3u cmd %5lu data %6lu%s%s%s\n",
+               (k < DEMO_SCENES) ? demoNames[k] : "extras", pass, sent,
+               tft_cmd_bytes, tft_data_bytes,
+               diff ? ", differs from canvas" : "",
+               font ? ", changed panel font" : "",
+               resent ? ", resent an unchanged frame" : "");
+        failed += (diff != 0) || font || resent;
+      }
+    }
+  }
+  return failed != 0;
+}
@@ -0,0 +1,70 @@
+// Shows every UI screen through UI_updateDisplay() and writes the panel
+// RAM, as decoded from the I2C stream, to dir/NAME.pbm. For each screen
+// it prints the bytes and bus time it took at the SSD1306's clock, the
+// heap allocations made drawing it (none are allowed after UI_init()),
+// and a fingerprint of the panel.
+//
+// Usage: test_ui dir [hz]   hz is the I2C clock for SSD1306 transfers,
+//                           400000 by default
+
+#include "UI.h"
+#include "mock.h"
+
+extern uint16union_t Display_State;
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s dir [hz]\n", argv[0]);
+    return 1;
+  }
+  uint32_t hz = (argc > 2) ? strtoul(argv[2], NULL, 0) : 400000;
+  Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET, hz);
+  char path[256];
+
+  // Boot screens, each as soon as it is first shown
+  UI_init(&display);
+  printf("init allocs %lu\n", heap_allocs);
+  for (uint8_t shown = 0; Display_State.s.Hi == 0; mock_ms += 10) {
+    unsigned long b = wire_bytes, a = heap_allocs;
+    double t = wire_us;
+    UI_updateDisplay(&display, 6);
+    if ((Display_State.s.Hi == 0) && (Display_State.s.Lo != shown)) {
+      shown = Display_State.s.Lo;
+      printf("boot%d bytes %lu bus %.0f us, allocs %lu, panel %08x\n", shown,
+             wire_bytes - b, wire_us - t, heap_allocs - a,
+             fnv1a(oled_ram, sizeof oled_ram));
+      snprintf(path, sizeof path, "%s/boot%d.pbm", argv[1], shown);
+      oled_dump(path);
+    }
+  }
+
+  // Main menu screens, every speed on the speed setting. Each is drawn in
+  // full, then redrawn once the refresh period is up
+  for (uint8_t m = 1; m <= 2; m++) {
+    for (uint8_t s = 1; s <= 2; s++) {
+      for (uint8_t e = 0; e < 2; e++) {
+        for (int sp = 0; sp <= 12; sp += ((m == 1) && (s == 2)) ? 1 : 13) {
+          Display_State.s.Hi = m;
+          Display_State.s.Lo = s;
+          Emerg_Stop = e;
+          mock_ms += 10;
+          unsigned long b = wire_bytes, a = heap_allocs;
+          double t = wire_us;
+          UI_updateDisplay(&display, sp);
+          printf("m%d_s%d_e%d_sp%d bytes %lu bus %.0f us", m, s, e, sp,
+                 wire_bytes - b, wire_us - t);
+          mock_ms += UI_REFRESH_PERIOD;
+          b = wire_bytes;
+          UI_updateDisplay(&display, sp);
+          printf(", refresh bytes %lu, allocs %lu, panel %08x\n",
+                 wire_bytes - b, heap_allocs - a,
+                 fnv1a(oled_ram, sizeof oled_ram));
+          snprintf(path, sizeof path, "%s/m%d_s%d_e%d_sp%d.pbm", argv[1], m,
+                   s, e, sp);
+          oled_dump(path);
+        }
+      }
+    }
+  }
+  return 0;
+}